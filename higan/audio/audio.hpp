@@ -45,6 +45,10 @@ struct Filter {
   enum class Type : uint { LowPass, HighPass };
 
   Order order;
+  Type type;
+  double cutoffFrequency;
+  uint passes;
+  uint pass;
   DSP::IIR::OnePole onePole;  //first-order
   DSP::IIR::Biquad biquad;    //second-order
 };
@@ -66,6 +70,8 @@ struct Stream {
   }
 
 private:
+  auto resetFilter(Filter& filter) -> void;
+
   struct Channel {
     vector<Filter> filters;
     DSP::Resampler::Cubic resampler;
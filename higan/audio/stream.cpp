@@ -17,31 +17,38 @@ auto Stream::setFrequency(double inputFrequency, maybe<double> outputFrequency)
 
   for(auto& channel : channels) {
     channel.resampler.reset(this->inputFrequency, this->outputFrequency);
+    //filter coefficients depend upon the input frequency
+    for(auto& filter : channel.filters) resetFilter(filter);
   }
 }
 
 auto Stream::addFilter(Filter::Order order, Filter::Type type, double cutoffFrequency, uint passes) -> void {
   for(auto& channel : channels) {
-    for(auto pass : range(passes)) {
-      Filter filter{order};
+    for(uint pass : range(passes)) {
+      Filter filter{order, type, cutoffFrequency, passes, pass};
+      resetFilter(filter);
+      channel.filters.append(filter);
+    }
+  }
+}
 
-      if(order == Filter::Order::First) {
-        DSP::IIR::OnePole::Type _type;
-        if(type == Filter::Type::LowPass) _type = DSP::IIR::OnePole::Type::LowPass;
-        if(type == Filter::Type::HighPass) _type = DSP::IIR::OnePole::Type::HighPass;
-        filter.onePole.reset(_type, cutoffFrequency, inputFrequency);
-      }
+auto Stream::resetFilter(Filter& filter) -> void {
+  //cutoffs at or beyond the Nyquist frequency are unstable: keep them below it for low input frequencies
+  double cutoffFrequency = min(filter.cutoffFrequency, inputFrequency * 0.45);
 
-      if(order == Filter::Order::Second) {
-        DSP::IIR::Biquad::Type _type;
-        if(type == Filter::Type::LowPass) _type = DSP::IIR::Biquad::Type::LowPass;
-        if(type == Filter::Type::HighPass) _type = DSP::IIR::Biquad::Type::HighPass;
-        double q = DSP::IIR::Biquad::butterworth(passes * 2, pass);
-        filter.biquad.reset(_type, cutoffFrequency, inputFrequency, q);
-      }
+  if(filter.order == Filter::Order::First) {
+    DSP::IIR::OnePole::Type _type;
+    if(filter.type == Filter::Type::LowPass) _type = DSP::IIR::OnePole::Type::LowPass;
+    if(filter.type == Filter::Type::HighPass) _type = DSP::IIR::OnePole::Type::HighPass;
+    filter.onePole.reset(_type, cutoffFrequency, inputFrequency);
+  }
 
-      channel.filters.append(filter);
-    }
+  if(filter.order == Filter::Order::Second) {
+    DSP::IIR::Biquad::Type _type;
+    if(filter.type == Filter::Type::LowPass) _type = DSP::IIR::Biquad::Type::LowPass;
+    if(filter.type == Filter::Type::HighPass) _type = DSP::IIR::Biquad::Type::HighPass;
+    double q = DSP::IIR::Biquad::butterworth(filter.passes * 2, filter.pass);
+    filter.biquad.reset(_type, cutoffFrequency, inputFrequency, q);
   }
 }
 
@@ -18,7 +18,10 @@ namespace Emulator {
   static const string Website = "https://byuu.org/";
 
   //incremented only when serialization format changes
-  static const string SerializerVersion = "104";
+  //105: GBA timer events, APU pending samples and prefetch; Famicom board, Mega Drive Z80 and
+  //PC Engine PSG catch-up state; paged memories. One bump covers all of them, so it stays
+  //for as long as any one of these changes is in the tree
+  static const string SerializerVersion = "105";
 
   namespace Constants {
     namespace Colorburst {
@@ -39,3 +42,4 @@ namespace Emulator {
 #include "platform.hpp"
 #include "interface.hpp"
 #include "game.hpp"
+#include "rom-cache.hpp"
@@ -2,6 +2,9 @@
 
 namespace Emulator {
 
+struct Profiler;
+struct Thread;
+
 struct Interface {
   struct Information {
     string manufacturer;
@@ -70,10 +73,30 @@ struct Interface {
   //state functions
   virtual auto serialize() -> serializer = 0;
   virtual auto unserialize(serializer&) -> bool = 0;
+  //only stores memory pages written since the state with generation() base was taken;
+  //cores without dirty page tracking return a full state, which unserializes the same way
+  virtual auto serializeIncremental(uint base) -> serializer { return serialize(); }
 
   //cheat functions
   virtual auto cheatSet(const string_vector& = {}) -> void {}
 
+  //memory functions
+  struct MemoryRegion {
+    string name;
+    uint8_t* data;  //live system memory; valid until the next load() or unload()
+    uint size;
+    uint address;   //base address of data in cheat code address space
+  };
+  virtual auto memoryRegions() -> vector<MemoryRegion> { return {}; }
+
+  //profiler functions
+  struct ProfilerTarget {
+    string name;
+    Profiler* profiler;
+    Thread* thread;  //clock source to pass to profiler->enable()
+  };
+  virtual auto profilerTargets() -> vector<ProfilerTarget> { return {}; }
+
   //settings
   virtual auto cap(const string& name) -> bool { return false; }
   virtual auto get(const string& name) -> any { return {}; }
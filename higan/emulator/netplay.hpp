@@ -0,0 +1,376 @@
+#pragma once
+
+namespace Emulator {
+
+//rollback netplay between two peers:
+//every frame runs at once, predicting that remote inputs which have not arrived yet repeat the last ones received.
+//when the real inputs arrive and differ from a prediction, the state saved before that frame is restored,
+//and every frame since is run again with the corrected inputs, with video and audio suppressed.
+//while running, Netplay stands in for the frontend as the platform, forwarding everything but input to it.
+
+struct Netplay : Platform {
+  enum : uint {
+    History = 64,      //frames of inputs and states kept
+    MaxRollback = 12,  //frames the local peer may run past the remote inputs received before it stalls
+    Redundancy = 8,    //frames of local input repeated in every packet, so that lost datagrams need no resend
+    Signature = 0x314c504e,  //"NPL1"
+  };
+
+  //unreliable, unordered datagram transport to the remote peer
+  struct Link {
+    virtual ~Link() = default;
+    virtual auto write(const vector<uint8_t>& packet) -> void = 0;
+    virtual auto read() -> vector<uint8_t> = 0;  //returns an empty packet when none are pending; never blocks
+  };
+
+  struct UDPLink : Link {
+    ~UDPLink() { close(); }
+
+    auto open(uint localPort, const string& hostname, uint remotePort) -> bool {
+      close();
+      addrinfo hint = {0};
+      hint.ai_family = AF_INET;
+      hint.ai_socktype = SOCK_DGRAM;
+      addrinfo* info = nullptr;
+      if(getaddrinfo(hostname, string{remotePort}, &hint, &info) != 0) return false;
+
+      sockaddr_in address = {0};
+      address.sin_family = AF_INET;
+      address.sin_addr.s_addr = htonl(INADDR_ANY);
+      address.sin_port = htons(localPort);
+
+      fd = socket(AF_INET, SOCK_DGRAM, 0);
+      bool opened = fd >= 0
+      && bind(fd, (sockaddr*)&address, sizeof(address)) == 0
+      && ::connect(fd, info->ai_addr, info->ai_addrlen) == 0;
+      freeaddrinfo(info);
+      if(!opened) close();
+      return opened;
+    }
+
+    auto close() -> void {
+      if(fd >= 0) ::close(fd);
+      fd = -1;
+    }
+
+    auto write(const vector<uint8_t>& packet) -> void override {
+      if(fd >= 0) send(fd, packet.data(), packet.size(), MSG_NOSIGNAL);
+    }
+
+    auto read() -> vector<uint8_t> override {
+      vector<uint8_t> packet;
+      pollfd query = {0};
+      query.fd = fd;
+      query.events = POLLIN;
+      if(fd < 0 || poll(&query, 1, 0) <= 0) return packet;
+      uint8_t buffer[1500];
+      auto length = recv(fd, buffer, sizeof(buffer), MSG_NOSIGNAL);
+      if(length > 0) packet.resize(length), memory::copy(packet.data(), buffer, length);
+      return packet;
+    }
+
+  private:
+    int fd = -1;
+  };
+
+  //in-process stand-in for UDPLink: a packet reaches the peer once its sender has written latency more packets
+  struct LoopbackLink : Link {
+    auto connect(LoopbackLink& peer, uint latency = 0) -> void {
+      this->peer = &peer;
+      this->latency = latency;
+    }
+
+    auto write(const vector<uint8_t>& packet) -> void override {
+      if(peer) peer->pending.append({written + latency, packet});
+      written++;
+    }
+
+    auto read() -> vector<uint8_t> override {
+      if(!peer) return {};
+      for(uint n : range(pending.size())) {
+        if(pending[n].deliver >= peer->written) continue;
+        auto packet = pending[n].packet;
+        pending.remove(n);
+        return packet;
+      }
+      return {};
+    }
+
+  private:
+    struct Packet {
+      uint64_t deliver;
+      vector<uint8_t> packet;
+    };
+    LoopbackLink* peer = nullptr;
+    uint latency = 0;
+    uint64_t written = 0;
+    vector<Packet> pending;
+  };
+
+  struct Statistics {
+    uint frames = 0;              //frames run, not counting resimulation
+    uint stalls = 0;              //calls to run() that waited on the remote peer instead
+    uint rollbacks = 0;
+    uint rollbackDepth = 0;       //frames resimulated by the most recent rollback
+    uint maxRollbackDepth = 0;
+    uint resimulatedFrames = 0;
+    uint64_t resimulationTime = 0;       //nanoseconds spent by the most recent rollback
+    uint64_t maxResimulationTime = 0;
+    uint64_t totalResimulationTime = 0;
+  };
+
+  //platform is set to this Netplay until stop(); host receives everything but input polls
+  auto start(Interface& emulator, Platform& host, Link& link) -> void {
+    this->emulator = &emulator;
+    this->host = &host;
+    this->link = &link;
+    ports.reset();
+    localValues = 0;
+    remoteValues = 0;
+    frame = 0;
+    remoteFrames = 0;
+    rollbackFrame = ~0u;
+    resimulating = false;
+    _statistics = {};
+    for(auto& input : localInputs) input.frame = ~0u;
+    for(auto& input : remoteInputs) input.frame = ~0u;
+    for(auto& state : states) state.frame = ~0u;
+    platform = this;
+  }
+
+  auto stop() -> void {
+    if(host) platform = host;
+    emulator = nullptr;
+    host = nullptr;
+    link = nullptr;
+  }
+
+  //both peers must connect the same devices in the same order, with local reversed
+  auto connect(uint port, uint device, bool local) -> void {
+    uint inputs = 0;
+    for(auto& interfacePort : emulator->ports) {
+      if(interfacePort.id != port) continue;
+      for(auto& interfaceDevice : interfacePort.devices) {
+        if(interfaceDevice.id == device) inputs = interfaceDevice.inputs.size();
+      }
+    }
+    ports.append({port, device, local, local ? localValues : remoteValues, inputs});
+    (local ? localValues : remoteValues) += inputs;
+  }
+
+  //local inputs are applied this many frames after they are polled, trading latency for fewer rollbacks
+  auto setInputDelay(uint frames) -> void {
+    inputDelay = min(frames, (uint)MaxRollback);
+  }
+
+  auto statistics() const -> const Statistics& {
+    return _statistics;
+  }
+
+  //packet: signature, first frame, frame count, values per frame; then the int16 values of each frame in turn
+  //exposed so that tools can stand in for a remote peer
+  static auto encode(uint first, uint count, uint values, const int16_t* inputs) -> vector<uint8_t> {
+    vector<uint8_t> packet;
+    auto write = [&](uint value, uint bytes) { for(uint n : range(bytes)) packet.append(value >> n * 8); };
+    write(Signature, 4);
+    write(first, 4);
+    write(count, 1);
+    write(values, 2);
+    for(uint n : range(count * values)) write((uint16_t)inputs[n], 2);
+    return packet;
+  }
+
+  //runs one frame, after resimulating any frames whose remote inputs were mispredicted
+  //returns false without running when the remote peer has fallen more than MaxRollback frames behind
+  auto run() -> bool {
+    if(frame == 0) {
+      for(uint delay : range(inputDelay)) {
+        localInput(delay).frame = delay;
+        localInput(delay).values.reset();
+        localInput(delay).values.resize(localValues);
+      }
+    }
+
+    receive();
+    if(frame >= remoteFrames + MaxRollback) {
+      transmit();
+      _statistics.stalls++;
+      return false;
+    }
+
+    auto& input = localInput(frame + inputDelay);
+    input.frame = frame + inputDelay;
+    input.values.reset();
+    input.values.resize(localValues);
+    for(auto& port : ports) {
+      if(!port.local) continue;
+      for(uint n : range(port.inputs)) input.values[port.offset + n] = host->inputPoll(port.id, port.device, n);
+    }
+    transmit();
+
+    if(rollbackFrame < frame) rollback();
+    step();
+    _statistics.frames++;
+    return true;
+  }
+
+  //Platform
+  auto path(uint id) -> string override { return host->path(id); }
+  auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override { return host->open(id, name, mode, required); }
+  auto load(uint id, string name, string type, string_vector options) -> Load override { return host->load(id, name, type, options); }
+  auto dipSettings(Markup::Node node) -> uint override { return host->dipSettings(node); }
+  auto notify(string text) -> void override { return host->notify(text); }
+
+  auto videoRefresh(const uint32* data, uint pitch, uint width, uint height) -> void override {
+    if(!resimulating) host->videoRefresh(data, pitch, width, height);
+  }
+
+  auto audioSample(const double* samples, uint channels) -> void override {
+    if(!resimulating) host->audioSample(samples, channels);
+  }
+
+  auto inputRumble(uint port, uint device, uint input, bool enable) -> void override {
+    if(!resimulating) host->inputRumble(port, device, input, enable);
+  }
+
+  //unconnected ports read as released, so that both peers see the same inputs
+  auto inputPoll(uint port, uint device, uint input) -> int16 override {
+    for(auto& connection : ports) {
+      if(connection.id != port || connection.device != device || input >= connection.inputs) continue;
+      auto& values = connection.local ? localInput(frame).values : state(frame).remote;
+      if(connection.offset + input >= values.size()) return 0;
+      return values[connection.offset + input];
+    }
+    return 0;
+  }
+
+private:
+  struct Port {
+    uint id;
+    uint device;
+    bool local;
+    uint offset;  //into the local or remote input values of a frame
+    uint inputs;
+  };
+
+  struct Input {
+    uint frame = ~0u;
+    vector<int16_t> values;
+  };
+
+  struct State {
+    uint frame = ~0u;
+    serializer state;        //taken before the frame ran
+    vector<int16_t> remote;  //remote inputs the frame ran with: received or predicted
+  };
+
+  auto localInput(uint frame) -> Input& { return localInputs[frame % History]; }
+  auto remoteInput(uint frame) -> Input& { return remoteInputs[frame % History]; }
+  auto state(uint frame) -> State& { return states[frame % History]; }
+
+  //remote inputs not received yet are predicted to repeat the most recent ones that were
+  auto predict(uint frame) -> vector<int16_t> {
+    if(remoteInput(frame).frame == frame) return remoteInput(frame).values;
+    if(remoteFrames && remoteInput(remoteFrames - 1).frame == remoteFrames - 1) return remoteInput(remoteFrames - 1).values;
+    vector<int16_t> released;
+    released.resize(remoteValues);
+    return released;
+  }
+
+  //runs the current frame, saving the state it starts from so that it can be run again
+  auto step() -> void {
+    auto& slot = state(frame);
+    slot.frame = frame;
+    slot.remote = predict(frame);
+    slot.state = emulator->serialize();
+    emulator->run();
+    frame++;
+  }
+
+  auto rollback() -> void {
+    auto target = frame;
+    auto depth = frame - rollbackFrame;
+    auto start = chrono::nanosecond();
+
+    serializer s{state(rollbackFrame).state.data(), state(rollbackFrame).state.size()};
+    emulator->unserialize(s);
+    frame = rollbackFrame;
+    rollbackFrame = ~0u;
+    resimulating = true;
+    while(frame < target) step();
+    resimulating = false;
+
+    auto time = chrono::nanosecond() - start;
+    _statistics.rollbacks++;
+    _statistics.rollbackDepth = depth;
+    _statistics.maxRollbackDepth = max(_statistics.maxRollbackDepth, depth);
+    _statistics.resimulatedFrames += depth;
+    _statistics.resimulationTime = time;
+    _statistics.maxResimulationTime = max(_statistics.maxResimulationTime, time);
+    _statistics.totalResimulationTime += time;
+  }
+
+  auto transmit() -> void {
+    uint known = localInput(frame + inputDelay).frame == frame + inputDelay ? frame + inputDelay + 1 : frame + inputDelay;
+    if(!known) return;
+    uint last = known - 1;
+    uint first = last >= Redundancy - 1 ? last - (Redundancy - 1) : 0;
+    vector<int16_t> inputs;
+    for(uint frame : range(first, last + 1)) {
+      auto& input = localInput(frame);
+      for(uint n : range(localValues)) inputs.append(input.frame == frame ? input.values[n] : 0);
+    }
+    link->write(encode(first, last - first + 1, localValues, inputs.data()));
+  }
+
+  auto receive() -> void {
+    while(auto packet = link->read()) {
+      uint offset = 0;
+      auto read = [&](uint bytes) -> uint {
+        uint value = 0;
+        for(uint n : range(bytes)) value |= packet[offset++] << n * 8;
+        return value;
+      };
+      if(packet.size() < 11 || read(4) != Signature) continue;
+      uint first = read(4);
+      uint count = read(1);
+      uint values = read(2);
+      if(values != remoteValues || packet.size() != 11 + count * values * 2) continue;
+
+      for(uint received : range(first, first + count)) {
+        vector<int16_t> inputs;
+        for(uint n : range(values)) inputs.append((int16_t)read(2));
+        //frames older than the history were all received already, or the peers have desynchronized
+        if(received + History <= frame || received >= frame + History) continue;
+        auto& input = remoteInput(received);
+        if(input.frame == received) continue;
+        input.frame = received;
+        input.values = inputs;
+        if(received >= frame || state(received).frame != received) continue;
+        if(!memory::compare(state(received).remote.data(), inputs.data(), values * sizeof(int16_t))) continue;
+        rollbackFrame = min(rollbackFrame, received);
+      }
+      while(remoteInput(remoteFrames).frame == remoteFrames) remoteFrames++;
+    }
+  }
+
+  Interface* emulator = nullptr;
+  Platform* host = nullptr;
+  Link* link = nullptr;
+  vector<Port> ports;
+  uint localValues = 0;
+  uint remoteValues = 0;
+  uint inputDelay = 0;
+
+  uint frame = 0;             //next frame to run
+  uint remoteFrames = 0;      //remote inputs have been received for every frame before this one
+  uint rollbackFrame = ~0u;   //earliest frame that ran with mispredicted remote inputs
+  bool resimulating = false;
+
+  Input localInputs[History];
+  Input remoteInputs[History];
+  State states[History];
+  Statistics _statistics;
+};
+
+}
@@ -0,0 +1,258 @@
+#pragma once
+
+#include <emulator/thread.hpp>
+
+namespace Emulator {
+
+//sampling execution profiler for one processor:
+//every period cycles of the attached thread, the guest PC about to execute is recorded.
+//processors that report calls also maintain a shadow call stack, so that samples are
+//attributed to the innermost routine and to every routine that called into it.
+
+struct Profiler {
+  enum : uint32_t { TopLevel = ~0u };  //function key for samples taken outside of any tracked call
+
+  explicit operator bool() const { return thread; }
+
+  //period is in cycles of the attached thread
+  auto enable(Thread& thread, uint period = 1000) -> void {
+    this->thread = &thread;
+    this->period = thread.scalar() * max(1u, period);
+    start = thread.clock();
+    depth = 0;
+  }
+
+  auto disable() -> void {
+    thread = nullptr;
+    depth = 0;
+  }
+
+  auto reset() -> void {
+    samples.reset();
+    self.reset();
+    inclusive.reset();
+    calls.reset();
+    total = 0;
+    depth = 0;
+    if(thread) start = thread->clock();
+  }
+
+  //called before each instruction executes
+  inline auto instruction(uint32_t pc) -> void {
+    if(depth && pc == stack[depth - 1].returnAddress) depth--;
+    //unsigned wraparound also catches the scheduler rebasing clocks below start
+    if(thread->clock() - start >= period) sample(pc);
+  }
+
+  //target is the routine entered; returnAddress is the first instruction executed after it returns
+  inline auto call(uint32_t target, uint32_t returnAddress) -> void {
+    calls.increment((uint64_t)function() << 32 | target);
+    if(depth == Depth) {
+      //runaway stack (eg routines that discard their return address): forget the outermost frame
+      memory::move(&stack[0], &stack[1], (Depth - 1) * sizeof(Frame));
+      depth--;
+    }
+    stack[depth++] = {target, returnAddress};
+  }
+
+  //symbol files list one "address name" pair per line; addresses may be written as bank:address,
+  //and blank lines, section headers ([labels]) and comments (; or #) are ignored
+  auto loadSymbols(const string& text) -> void {
+    symbols.reset();
+    for(auto line : text.split("\n")) {
+      line.transform("\t", " ").strip();
+      if(!line || line.beginsWith(";") || line.beginsWith("#") || line.beginsWith("[")) continue;
+      auto part = line.split(" ", 1L);
+      if(part.size() != 2) continue;
+      auto address = part[0].replace(":", "").trimLeft("$", 1L).trimLeft("0x", 1L);
+      if(!address) continue;
+      symbols.append({(uint32_t)address.hex(), part[1].strip()});
+    }
+    sort(symbols.data(), symbols.size(), [](const Symbol& x, const Symbol& y) {
+      return x.address < y.address;
+    });
+  }
+
+  auto symbolize(uint32_t address) const -> string {
+    if(address == TopLevel) return "(top level)";
+    uint index = symbolIndex(address);
+    if(index == Unresolved) return {"$", hex(address, 6L)};
+    auto& symbol = symbols[index];
+    if(symbol.address == address) return symbol.name;
+    return {symbol.name, "+$", hex(address - symbol.address)};
+  }
+
+  //samples per address, or per symbol once symbols are loaded; most frequent first
+  auto flatReport() const -> string {
+    vector<Table::Entry> entries;
+    if(!symbols) {
+      entries = samples.entries();
+    } else {
+      Table grouped;
+      for(auto& entry : samples.entries()) grouped.increment(symbolIndex(entry.key), entry.count);
+      entries = grouped.entries();
+    }
+    sortEntries(entries);
+
+    string output;
+    output.append("  samples        %  location\n");
+    for(auto& entry : entries) {
+      output.append(pad(entry.count, 9), "  ", percent(entry.count), "  ");
+      if(!symbols) output.append(symbolize(entry.key), "\n");
+      else if(entry.key == Unresolved) output.append("(no symbol)\n");
+      else output.append(symbols[entry.key].name, "\n");
+    }
+    return output;
+  }
+
+  //per tracked routine, most expensive first: inclusive and self samples, then call counts per caller
+  auto graphReport() const -> string {
+    auto entries = inclusive.entries();
+    sortEntries(entries);
+    auto edges = calls.entries();
+    sortEntries(edges);
+
+    string output;
+    output.append("inclusive     self    calls  routine\n");
+    for(auto& entry : entries) {
+      uint32_t function = entry.key;
+      uint64_t callCount = 0;
+      for(auto& edge : edges) if((uint32_t)edge.key == function) callCount += edge.count;
+      output.append(percent(entry.count), "  ", percent(self.find(function)), "  ");
+      output.append(pad(callCount, 7), "  ", symbolize(function), "\n");
+      for(auto& edge : edges) {
+        if((uint32_t)edge.key != function) continue;
+        output.append("                   ", pad(edge.count, 7), "  <- ", symbolize(edge.key >> 32), "\n");
+      }
+    }
+    return output;
+  }
+
+private:
+  //open-addressed hash table of 64-bit keys to counts, at most half full
+  struct Table {
+    struct Entry {
+      uint64_t key;
+      uint64_t count;
+    };
+
+    auto reset() -> void {
+      slots.reset();
+      used = 0;
+    }
+
+    auto increment(uint64_t key, uint64_t count = 1) -> void {
+      if(used * 2 >= slots.size()) grow();
+      auto& slot = locate(key);
+      if(!slot.count) slot.key = key, used++;
+      slot.count += count;
+    }
+
+    auto find(uint64_t key) const -> uint64_t {
+      if(!slots) return 0;
+      uint mask = slots.size() - 1;
+      for(uint index = hash(key) & mask; slots[index].count; index = index + 1 & mask) {
+        if(slots[index].key == key) return slots[index].count;
+      }
+      return 0;
+    }
+
+    auto entries() const -> vector<Entry> {
+      vector<Entry> result;
+      for(auto& slot : slots) if(slot.count) result.append(slot);
+      return result;
+    }
+
+  private:
+    static auto hash(uint64_t key) -> uint {
+      return key * 0x9e3779b97f4a7c15ull >> 32;
+    }
+
+    auto locate(uint64_t key) -> Entry& {
+      uint mask = slots.size() - 1;
+      uint index = hash(key) & mask;
+      while(slots[index].count && slots[index].key != key) index = index + 1 & mask;
+      return slots[index];
+    }
+
+    auto grow() -> void {
+      auto previous = move(slots);
+      slots.resize(max(256u, previous.size() * 2));
+      for(auto& slot : previous) if(slot.count) locate(slot.key) = slot;
+    }
+
+    vector<Entry> slots;  //count == 0 marks an empty slot
+    uint used = 0;
+  };
+
+  struct Frame {
+    uint32_t target;
+    uint32_t returnAddress;
+  };
+
+  struct Symbol {
+    uint32_t address;
+    string name;
+  };
+
+  enum : uint { Depth = 64, Unresolved = ~0u };
+
+  auto function() const -> uint32_t {
+    return depth ? stack[depth - 1].target : (uint32_t)TopLevel;
+  }
+
+  auto sample(uint32_t pc) -> void {
+    auto clock = thread->clock();
+    if(clock < start) { start = clock; return; }
+    start = clock - (clock - start) % period;
+
+    total++;
+    samples.increment(pc);
+    self.increment(function());
+    //count each routine once per sample, even when it appears recursively
+    inclusive.increment(TopLevel);
+    for(uint n : range(depth)) {
+      bool duplicate = false;
+      for(uint m : range(n)) duplicate |= stack[m].target == stack[n].target;
+      if(!duplicate) inclusive.increment(stack[n].target);
+    }
+  }
+
+  //binary search for the last symbol at or before address
+  auto symbolIndex(uint32_t address) const -> uint {
+    uint lo = 0, hi = symbols.size();
+    while(lo < hi) {
+      uint mid = (lo + hi) / 2;
+      if(symbols[mid].address <= address) lo = mid + 1;
+      else hi = mid;
+    }
+    return lo ? lo - 1 : (uint)Unresolved;
+  }
+
+  auto percent(uint64_t count) const -> string {
+    uint64_t hundredths = total ? count * 10000 / total : 0;
+    return {pad(hundredths / 100, 4), ".", pad(hundredths % 100, 2, '0'), "%"};
+  }
+
+  static auto sortEntries(vector<Table::Entry>& entries) -> void {
+    sort(entries.data(), entries.size(), [](const Table::Entry& x, const Table::Entry& y) {
+      return x.count > y.count;
+    });
+  }
+
+  Thread* thread = nullptr;
+  uintmax period = 0;
+  uintmax start = 0;
+  uint64_t total = 0;
+
+  Table samples;    //pc => samples
+  Table self;       //innermost routine => samples
+  Table inclusive;  //routine anywhere on the call stack => samples
+  Table calls;      //caller << 32 | callee => calls
+
+  Frame stack[Depth];
+  uint depth = 0;
+  vector<Symbol> symbols;
+};
+
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+namespace Emulator {
+
+//process-wide cache of read-only ROM images, keyed by the SHA-256 of their contents
+//every core that loads the same image maps one refcounted, page-aligned buffer,
+//so an additional instance of a game only costs its RAM and state
+
+struct ROMCache {
+  enum : uint { PageSize = 4096 };
+
+  //returns the shared copy of data[0-size), adding a reference to it
+  //the caller keeps ownership of data, which may be released immediately afterward
+  static auto acquire(const uint8_t* data, uint size) -> const uint8_t* {
+    if(!data || !size) return nullptr;
+    auto sha256 = Hash::SHA256(data, size).digest();
+
+    auto& self = instance();
+    std::lock_guard<std::mutex> lock(self.mutex);
+    for(auto& image : self.images) {
+      if(image.size != size || image.sha256 != sha256) continue;
+      image.references++;
+      return image.data;
+    }
+
+    Image image;
+    image.sha256 = sha256;
+    image.allocation = new uint8_t[size + PageSize - 1];
+    image.data = (uint8_t*)(((uintptr)image.allocation + PageSize - 1) & ~(uintptr)(PageSize - 1));
+    image.size = size;
+    image.references = 1;
+    memory::copy(image.data, data, size);
+    self.images.append(image);
+    return image.data;
+  }
+
+  //drops one reference to a buffer returned by acquire(); the last reference frees it
+  static auto release(const uint8_t* data) -> void {
+    if(!data) return;
+
+    auto& self = instance();
+    std::lock_guard<std::mutex> lock(self.mutex);
+    for(uint n : range(self.images.size())) {
+      auto& image = self.images[n];
+      if(image.data != data) continue;
+      if(--image.references) return;
+      delete[] image.allocation;
+      self.images.remove(n);
+      return;
+    }
+  }
+
+  //number of distinct images currently shared, and the bytes they occupy
+  static auto count() -> uint {
+    auto& self = instance();
+    std::lock_guard<std::mutex> lock(self.mutex);
+    return self.images.size();
+  }
+
+  static auto footprint() -> uint64_t {
+    auto& self = instance();
+    std::lock_guard<std::mutex> lock(self.mutex);
+    uint64_t bytes = 0;
+    for(auto& image : self.images) bytes += image.size;
+    return bytes;
+  }
+
+private:
+  struct Image {
+    string sha256;
+    uint8_t* allocation = nullptr;
+    uint8_t* data = nullptr;
+    uint size = 0;
+    uint references = 0;
+  };
+
+  static auto instance() -> ROMCache& {
+    static ROMCache self;
+    return self;
+  }
+
+  std::mutex mutex;
+  vector<Image> images;
+};
+
+}
@@ -4,15 +4,23 @@ struct BandaiFCG : Board {
   BandaiFCG(Markup::Node& document) : Board(document) {
   }
 
-  auto main() -> void {
-    if(irqCounterEnable) {
-      if(--irqCounter == 0xffff) {
-        cpu.irqLine(1);
-        irqCounterEnable = false;
-      }
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    if(!irqCounterEnable) return;
+    if(cycles <= irqCounter) {
+      irqCounter -= cycles;
+    } else {
+      irqCounter = 0xffff;
+      cpu.irqLine(1);
+      irqCounterEnable = false;
     }
+  }
 
-    tick();
+  auto next() const -> uint {
+    return irqCounterEnable ? irqCounter + 1 : 4095;
   }
 
   auto addrCIRAM(uint addr) const -> uint {
@@ -47,9 +55,11 @@ struct BandaiFCG : Board {
         mirror = data & 0x03;
         break;
       case 0x0a:
+        cartridge.update();
         cpu.irqLine(0);
         irqCounterEnable = data & 0x01;
         irqCounter = irqLatch;
+        cartridge.reschedule();
         break;
       case 0x0b:
         irqLatch = (irqLatch & 0xff00) | (data << 0);
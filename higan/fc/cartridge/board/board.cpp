@@ -28,6 +28,7 @@ Board::Board(Markup::Node& document) {
     if(auto fp = platform->open(cartridge.pathID(), memory.name(), File::Read, File::Required)) {
       fp->read(prgrom.data, min(prgrom.size, fp->size()));
     }
+    prgrom.share();
   }
 
   if(auto memory = Emulator::Game::Memory{document["game/board/memory(type=RAM,content=Save)"]}) {
@@ -44,6 +45,7 @@ Board::Board(Markup::Node& document) {
     if(auto fp = platform->open(cartridge.pathID(), memory.name(), File::Read, File::Required)) {
       fp->read(chrrom.data, min(chrrom.size, fp->size()));
     }
+    chrrom.share();
   }
 
   if(auto memory = Emulator::Game::Memory{document["game/board/memory(type=RAM,content=Character)"]}) {
@@ -76,6 +78,15 @@ auto Board::save() -> void {
   }
 }
 
+//ROM is never writable, so it can map the process-wide shared copy directly
+auto Board::Memory::share() -> void {
+  if(shared || writable || !data) return;
+  auto image = Emulator::ROMCache::acquire(data, size);
+  delete[] data;
+  data = (uint8_t*)image;
+  shared = true;
+}
+
 auto Board::Memory::read(uint addr) const -> uint8 {
   return data[mirror(addr, size)];
 }
@@ -103,7 +114,6 @@ auto Board::mirror(uint addr, uint size) -> uint {
 }
 
 auto Board::main() -> void {
-  cartridge.step(cartridge.rate() * 4095);
   tick();
 }
 
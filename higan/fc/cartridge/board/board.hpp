@@ -2,8 +2,9 @@ struct Board {
   struct Memory {
     inline Memory(uint8_t* data, uint size) : data(data), size(size) {}
     inline Memory() : data(nullptr), size(0u), writable(false) {}
-    inline ~Memory() { if(data) delete[] data; }
+    inline ~Memory() { if(shared) Emulator::ROMCache::release(data); else if(data) delete[] data; }
 
+    inline auto share() -> void;
     inline auto read(uint addr) const -> uint8;
     inline auto write(uint addr, uint8 data) -> void;
 
@@ -11,6 +12,7 @@ struct Board {
     uint8_t* data = nullptr;
     uint size = 0;
     bool writable = false;
+    bool shared = false;
   };
 
   virtual ~Board() = default;
@@ -20,6 +22,15 @@ struct Board {
   Board(Markup::Node& document);
   auto save() -> void;
 
+  //how the cartridge thread runs the board:
+  //None: the board has no timers, and is never scheduled
+  //Lazy: timers are advanced in bulk by run() when observed, and next() bounds the sleep until the next event
+  //Cycle: main() runs once per CPU cycle
+  enum class Clocking : uint { None, Lazy, Cycle };
+  virtual auto clocking() const -> Clocking { return Clocking::None; }
+  virtual auto run(uint cycles) -> void {}
+  virtual auto next() const -> uint { return 4095; }
+
   virtual auto main() -> void;
   virtual auto tick() -> void;
 
@@ -3,8 +3,16 @@ struct KonamiVRC3 : Board {
     settings.mirror = document["board/mirror/mode"].text() == "vertical" ? 1 : 0;
   }
 
-  auto main() -> void {
-    vrc3.main();
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    vrc3.run(cycles);
+  }
+
+  auto next() const -> uint {
+    return vrc3.next();
   }
 
   auto readPRG(uint addr) -> uint8 {
@@ -4,8 +4,16 @@ struct KonamiVRC4 : Board {
     settings.pinout.a1 = 1 << document["board/chip/pinout/a1"].natural();
   }
 
-  auto main() -> void {
-    return vrc4.main();
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    vrc4.run(cycles);
+  }
+
+  auto next() const -> uint {
+    return vrc4.next();
   }
 
   auto readPRG(uint addr) -> uint8 {
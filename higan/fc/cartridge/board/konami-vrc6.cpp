@@ -32,6 +32,7 @@ struct KonamiVRC6 : Board {
     vrc6.serialize(s);
   }
 
+  auto clocking() const -> Clocking { return Clocking::Cycle; }
   auto main() -> void { vrc6.main(); }
   auto power() -> void { vrc6.power(); }
 
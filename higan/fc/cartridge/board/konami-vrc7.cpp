@@ -2,8 +2,16 @@ struct KonamiVRC7 : Board {
   KonamiVRC7(Markup::Node& document) : Board(document), vrc7(*this) {
   }
 
-  auto main() -> void {
-    return vrc7.main();
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    vrc7.run(cycles);
+  }
+
+  auto next() const -> uint {
+    return vrc7.next();
   }
 
   auto readPRG(uint addr) -> uint8 {
@@ -3,6 +3,10 @@ struct NES_ExROM : Board {
     revision = Revision::ELROM;
   }
 
+  auto clocking() const -> Clocking {
+    return Clocking::Cycle;
+  }
+
   auto main() -> void {
     mmc5.main();
   }
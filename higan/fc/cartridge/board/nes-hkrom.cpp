@@ -2,8 +2,12 @@ struct NES_HKROM : Board {
   NES_HKROM(Markup::Node& document) : Board(document), mmc6(*this) {
   }
 
-  auto main() -> void {
-    mmc6.main();
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    mmc6.run(cycles);
   }
 
   auto readPRG(uint addr) -> uint8 {
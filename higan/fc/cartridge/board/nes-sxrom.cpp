@@ -3,8 +3,12 @@ struct NES_SxROM : Board {
     revision = Revision::SXROM;
   }
 
-  auto main() -> void {
-    return mmc1.main();
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    mmc1.run(cycles);
   }
 
   auto addrRAM(uint addr) -> uint {
@@ -3,8 +3,12 @@ struct NES_TxROM : Board {
     revision = Revision::TLROM;
   }
 
-  auto main() -> void {
-    mmc3.main();
+  auto clocking() const -> Clocking {
+    return Clocking::Lazy;
+  }
+
+  auto run(uint cycles) -> void {
+    mmc3.run(cycles);
   }
 
   auto readPRG(uint addr) -> uint8 {
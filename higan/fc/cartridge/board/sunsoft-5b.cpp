@@ -43,6 +43,10 @@ struct Sunsoft5B : Board {
     uint4 output;
   } pulse[3];
 
+  auto clocking() const -> Clocking {
+    return Clocking::Cycle;
+  }
+
   auto main() -> void {
     if(irqCounterEnable) {
       if(--irqCounter == 0xffff) {
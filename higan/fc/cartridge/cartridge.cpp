@@ -12,7 +12,34 @@ auto Cartridge::Enter() -> void {
 }
 
 auto Cartridge::main() -> void {
-  board->main();
+  if(clocking == Board::Clocking::Cycle) return board->main();
+
+  //catch up, then sleep until the cycle of the board's next timer event
+  update();
+  uint cycles = board->next();
+  step(rate() * (cycles - 1 - pending));
+  pending = cycles - 1;
+  synchronize(cpu);
+}
+
+//runs a lazy board through every cycle the CPU has reached
+auto Cartridge::update() -> void {
+  if(clocking != Board::Clocking::Lazy) return;
+  intmax unit = rate() * scalar();
+  intmax reached = (intmax)(cpu.clock() - clock()) + pending * unit;  //relative to the next cycle to run
+  //the CPU synchronizes the cartridge after the PPU, so the PPU runs before the board sees the CPU's last cycle
+  if(ppu.active()) reached -= unit;
+  if(reached < 0) return;
+  uint cycles = reached / unit + 1;
+  pending -= cycles;
+  board->run(cycles);
+}
+
+//after reprogramming a lazy board, wake up on its next cycle in case an event moved closer
+auto Cartridge::reschedule() -> void {
+  if(clocking != Board::Clocking::Lazy) return;
+  setClock(clock() - (uintmax)pending * rate() * scalar());
+  pending = 0;
 }
 
 auto Cartridge::load() -> bool {
@@ -47,7 +74,10 @@ auto Cartridge::unload() -> void {
 }
 
 auto Cartridge::power() -> void {
-  create(Cartridge::Enter, system.frequency());
+  clocking = board->clocking();
+  pending = 0;
+  //boards without timers are left out of the scheduler entirely
+  if(clocking != Board::Clocking::None) create(Cartridge::Enter, system.frequency());
   board->power();
 }
 
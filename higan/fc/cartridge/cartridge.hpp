@@ -7,6 +7,8 @@ struct Cartridge : Thread {
   //cartridge.cpp
   static auto Enter() -> void;
   auto main() -> void;
+  auto update() -> void;
+  auto reschedule() -> void;
 
   auto pathID() const -> uint { return information.pathID; }
   auto region() const -> string { return information.region; }
@@ -33,6 +35,8 @@ struct Cartridge : Thread {
 
 //privileged:
   Board* board = nullptr;
+  Board::Clocking clocking = Board::Clocking::None;
+  int pending = 0;  //cycles between the next cycle a lazy board has yet to run and the thread clock
 
   auto readPRG(uint addr) -> uint8;
   auto writePRG(uint addr, uint8 data) -> void;
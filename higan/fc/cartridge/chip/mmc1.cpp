@@ -3,9 +3,8 @@ struct MMC1 : Chip {
     revision = Revision::MMC1B2;
   }
 
-  auto main() -> void {
-    if(writedelay) writedelay--;
-    tick();
+  auto run(uint cycles) -> void {
+    writedelay -= min(writedelay, cycles);
   }
 
   auto addrPRG(uint addr) -> uint {
@@ -37,6 +36,7 @@ struct MMC1 : Chip {
   }
 
   auto writeIO(uint addr, uint8 data) -> void {
+    cartridge.update();
     if(writedelay) return;
     writedelay = 2;
 
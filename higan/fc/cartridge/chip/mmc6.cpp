@@ -2,19 +2,19 @@ struct MMC6 : Chip {
   MMC6(Board& board) : Chip(board) {
   }
 
-  auto main() -> void {
-    if(irqDelay) irqDelay--;
+  auto run(uint cycles) -> void {
+    irqDelay -= min(irqDelay, cycles);
     cpu.irqLine(irqLine);
-    tick();
   }
 
   auto irqTest(uint addr) -> void {
     if(!(chrAbus & 0x1000) && (addr & 0x1000)) {
+      cartridge.update();
       if(irqDelay == 0) {
         if(irqCounter == 0) {
           irqCounter = irqLatch;
         } else if(--irqCounter == 0) {
-          if(irqEnable) irqLine = 1;
+          if(irqEnable) irqLine = 1, cartridge.reschedule();
         }
       }
       irqDelay = 6;
@@ -122,8 +122,10 @@ struct MMC6 : Chip {
       break;
 
     case 0xe000:
+      cartridge.update();
       irqEnable = false;
       irqLine = 0;
+      cartridge.reschedule();
       break;
 
     case 0xe001:
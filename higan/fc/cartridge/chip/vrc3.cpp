@@ -2,26 +2,31 @@ struct VRC3 : Chip {
   VRC3(Board& board) : Chip(board) {
   }
 
-  auto main() -> void {
-    if(irqEnable) {
-      if(irqMode == 0) {  //16-bit
-        if(++irqCounter.w == 0) {
-          irqLine = 1;
-          irqEnable = irqAcknowledge;
-          irqCounter.w = irqLatch;
-        }
-      }
-      if(irqMode == 1) {  //8-bit
-        if(++irqCounter.l == 0) {
-          irqLine = 1;
-          irqEnable = irqAcknowledge;
-          irqCounter.l = irqLatch;
-        }
+  auto run(uint cycles) -> void {
+    while(irqEnable) {
+      uint overflow = irqDistance();
+      if(cycles < overflow) {
+        if(irqMode == 0) irqCounter.w += cycles;  //16-bit
+        if(irqMode == 1) irqCounter.l += cycles;  //8-bit
+        break;
       }
+      cycles -= overflow;
+      irqLine = 1;
+      irqEnable = irqAcknowledge;
+      if(irqMode == 0) irqCounter.w = irqLatch;
+      if(irqMode == 1) irqCounter.l = irqLatch;
     }
 
     cpu.irqLine(irqLine);
-    tick();
+  }
+
+  auto next() const -> uint {
+    return irqEnable ? irqDistance() : 4095;
+  }
+
+  //cycles until the counter overflows
+  auto irqDistance() const -> uint {
+    return irqMode == 0 ? 0x10000 - irqCounter.w : 0x100 - irqCounter.l;
   }
 
   auto addrPRG(uint addr) const -> uint {
@@ -37,15 +42,19 @@ struct VRC3 : Chip {
     case 0xb000: irqLatch = (irqLatch & 0x0fff) | ((data & 0x0f) << 12); break;
 
     case 0xc000:
+      cartridge.update();
       irqMode = data & 0x04;
       irqEnable = data & 0x02;
       irqAcknowledge = data & 0x01;
       if(irqEnable) irqCounter.w = irqLatch;
+      cartridge.reschedule();
       break;
 
     case 0xd000:
+      cartridge.update();
       irqLine = 0;
       irqEnable = irqAcknowledge;
+      cartridge.reschedule();
       break;
 
     case 0xf000:
@@ -2,33 +2,49 @@ struct VRC4 : Chip {
   VRC4(Board& board) : Chip(board) {
   }
 
-  auto main() -> void {
-    if(irqEnable) {
-      if(irqMode == 0) {
-        irqScalar -= 3;
-        if(irqScalar <= 0) {
-          irqScalar += 341;
-          if(irqCounter == 0xff) {
-            irqCounter = irqLatch;
-            irqLine = 1;
-          } else {
-            irqCounter++;
-          }
-        }
+  auto run(uint cycles) -> void {
+    while(irqEnable) {
+      //the prescaler clocks the counter every 113 2/3 cycles in scanline mode
+      uint clock = irqMode == 0 ? irqPrescale(irqScalar) : 1;
+      if(cycles < clock) {
+        if(irqMode == 0) irqScalar -= 3 * (int)cycles;
+        break;
+      }
+      cycles -= clock;
+      if(irqMode == 0) irqScalar += 341 - 3 * (int)clock;
+      if(irqCounter == 0xff) {
+        irqCounter = irqLatch;
+        irqLine = 1;
+      } else {
+        irqCounter++;
       }
-
       if(irqMode == 1) {
-        if(irqCounter == 0xff) {
-          irqCounter = irqLatch;
-          irqLine = 1;
-        } else {
-          irqCounter++;
-        }
+        uint steps = min(cycles, 0xffu - irqCounter);
+        irqCounter += steps;
+        cycles -= steps;
       }
     }
 
     cpu.irqLine(irqLine);
-    tick();
+  }
+
+  auto next() const -> uint {
+    if(!irqEnable) return 4095;
+    if(irqMode == 1) return 0x100 - irqCounter;
+    uint cycles = 0;
+    int scalar = irqScalar;
+    for(uint counter = irqCounter; cycles < 4095; counter++) {
+      uint clock = irqPrescale(scalar);
+      cycles += clock;
+      scalar += 341 - 3 * (int)clock;
+      if(counter == 0xff) break;
+    }
+    return min(cycles, 4095u);
+  }
+
+  //cycles until the prescaler next clocks the counter
+  static auto irqPrescale(int scalar) -> uint {
+    return scalar > 0 ? (scalar + 2) / 3 : 1;
   }
 
   auto addrPRG(uint addr) const -> uint {
@@ -108,6 +124,7 @@ struct VRC4 : Chip {
       break;
 
     case 0xf002:
+      cartridge.update();
       irqMode = data & 0x04;
       irqEnable = data & 0x02;
       irqAcknowledge = data & 0x01;
@@ -116,11 +133,14 @@ struct VRC4 : Chip {
         irqScalar = 341;
       }
       irqLine = 0;
+      cartridge.reschedule();
       break;
 
     case 0xf003:
+      cartridge.update();
       irqEnable = irqAcknowledge;
       irqLine = 0;
+      cartridge.reschedule();
       break;
     }
   }
@@ -1,4 +1,5 @@
 auto Cartridge::serialize(serializer& s) -> void {
   Thread::serialize(s);
+  s.integer(pending);
   return board->serialize(s);
 }
@@ -20,7 +20,7 @@ auto CPU::step(uint clocks) -> void {
   Thread::step(clocks);
   synchronize(apu);
   synchronize(ppu);
-  synchronize(cartridge);
+  if(cartridge.clocking != Board::Clocking::None) synchronize(cartridge);
   for(auto peripheral : peripherals) synchronize(*peripheral);
 }
 
@@ -162,6 +162,10 @@ auto Interface::cheatSet(const string_vector& list) -> void {
   cheat.assign(list);
 }
 
+auto Interface::profilerTargets() -> vector<ProfilerTarget> {
+  return {{"CPU", &cpu.profiler, &cpu}};
+}
+
 auto Interface::cap(const string& name) -> bool {
   if(name == "Color Emulation") return true;
   if(name == "Scanline Emulation") return true;
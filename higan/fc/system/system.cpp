@@ -16,7 +16,7 @@ auto System::runToSave() -> void {
   scheduler.synchronize(cpu);
   scheduler.synchronize(apu);
   scheduler.synchronize(ppu);
-  scheduler.synchronize(cartridge);
+  if(cartridge.clocking != Board::Clocking::None) scheduler.synchronize(cartridge);
   for(auto peripheral : cpu.peripherals) scheduler.synchronize(*peripheral);
 }
 
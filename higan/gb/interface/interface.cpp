@@ -85,6 +85,15 @@ auto Interface::cheatSet(const string_vector& list) -> void {
   cheat.assign(list);
 }
 
+auto Interface::memoryRegions() -> vector<MemoryRegion> {
+  //$c000-$dfff: bank 0 followed by bank 1; other GBC banks are not addressable by cheat codes
+  return {{"WRAM", (uint8_t*)cpu.wram, 8192, 0xc000}};
+}
+
+auto Interface::profilerTargets() -> vector<ProfilerTarget> {
+  return {{"CPU", &cpu.profiler, &cpu}};
+}
+
 auto Interface::cap(const string& name) -> bool {
   if(name == "Blur Emulation") return true;
   if(name == "Color Emulation") return true;
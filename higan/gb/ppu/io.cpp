@@ -101,6 +101,8 @@ auto PPU::readIO(uint16 addr) -> uint8 {
 }
 
 auto PPU::writeIO(uint16 addr, uint8 data) -> void {
+  if(status.mode == 3) render(pixel());
+
   if(addr >= 0x8000 && addr <= 0x9fff) {
     vram[vramAddress(addr)] = data;
     return;
@@ -117,6 +119,7 @@ auto PPU::writeIO(uint16 addr, uint8 data) -> void {
       status.mode = 0;
       status.ly = 0;
       status.lx = 0;
+      batch.active = false;
 
       //restart cothread to begin new frame
       auto clock = Thread::clock();
@@ -147,6 +150,7 @@ auto PPU::writeIO(uint16 addr, uint8 data) -> void {
       cpu.raise(CPU::Interrupt::Stat);
     }
 
+    if(batch.active) stat();
     return;
   }
 
@@ -167,6 +171,7 @@ auto PPU::writeIO(uint16 addr, uint8 data) -> void {
 
   if(addr == 0xff45) {  //LYC
     status.lyc = data;
+    if(batch.active) stat();
     return;
   }
 
@@ -174,6 +179,7 @@ auto PPU::writeIO(uint16 addr, uint8 data) -> void {
     status.dmaActive = true;
     status.dmaClock = 0;
     status.dmaBank = data;
+    if(batch.active) batch.dma = pixel();
     return;
   }
 
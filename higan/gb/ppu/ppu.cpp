@@ -29,11 +29,23 @@ auto PPU::main() -> void {
     scanline();
     step(92);
 
+    //without OAM DMA to advance, nothing in mode 3 needs the PPU clock by clock:
+    //STAT can then only rise through writes to STAT or LYC, which evaluate it themselves.
+    //the whole mode is charged at once, and the CPU runs through it in one synchronization
     status.mode = 3;
-    for(auto n : range(160)) {
-      run();
-      step(1);
+    if(!status.dmaActive) {
+      stat();
+      batch.active = true;
+      Thread::step(160);
+      synchronize(cpu);
+      batch.active = false;
+      status.lx += 160;
+      //an OAM DMA started during the block runs the clocks it has missed
+      if(status.dmaActive) for(uint n : range(160 - batch.dma)) dma();
+    } else {
+      step(160);
     }
+    render(160);
 
     status.mode = 0;
     cpu.hblank();
@@ -79,21 +91,7 @@ auto PPU::refresh() -> void {
 auto PPU::step(uint clocks) -> void {
   while(clocks--) {
     stat();
-    if(status.dmaActive) {
-      uint hi = status.dmaClock++;
-      uint lo = hi & (cpu.status.speedDouble ? 1 : 3);
-      hi >>= cpu.status.speedDouble ? 1 : 2;
-      if(lo == 0) {
-        if(hi == 0) {
-          //warm-up
-        } else if(hi == 161) {
-          //cool-down; disable
-          status.dmaActive = false;
-        } else {
-          oam[hi - 1] = bus.read(status.dmaBank << 8 | hi - 1);
-        }
-      }
-    }
+    if(status.dmaActive) dma();
 
     status.lx++;
     Thread::step(1);
@@ -101,6 +99,37 @@ auto PPU::step(uint clocks) -> void {
   }
 }
 
+auto PPU::dma() -> void {
+  uint hi = status.dmaClock++;
+  uint lo = hi & (cpu.status.speedDouble ? 1 : 3);
+  hi >>= cpu.status.speedDouble ? 1 : 2;
+  if(lo == 0) {
+    if(hi == 0) {
+      //warm-up
+    } else if(hi == 161) {
+      //cool-down; disable
+      status.dmaActive = false;
+    } else {
+      oam[hi - 1] = bus.read(status.dmaBank << 8 | hi - 1);
+    }
+  }
+}
+
+//mode 3 pixels are drawn lazily: the line is completed when mode 0 begins, and writes
+//during mode 3 that could change the line first draw the pixels already output by then
+auto PPU::render(uint pixels) -> void {
+  while(px < pixels) run();
+}
+
+//mode 3 pixels output by the time of a CPU access.
+//while mode 3 is charged in one block, lx stays at its start: the PPU clock is then at the end of mode 3,
+//and the pixel follows from how far the CPU is behind it, matching what clock-by-clock stepping would reach
+auto PPU::pixel() const -> uint {
+  if(!batch.active) return status.lx - 92;
+  if(cpu.clock() >= clock()) return 160;
+  return 160 - min(160u, (uint)((clock() - cpu.clock()) / scalar()));
+}
+
 auto PPU::hflip(uint data) const -> uint {
   return (data & 0x8080) >> 7 | (data & 0x4040) >> 5
        | (data & 0x2020) >> 3 | (data & 0x1010) >> 1
@@ -5,6 +5,9 @@ struct PPU : Thread, MMIO {
   auto coincidence() -> bool;
   auto refresh() -> void;
   auto step(uint clocks) -> void;
+  auto dma() -> void;
+  auto render(uint pixels) -> void;
+  auto pixel() const -> uint;
 
   auto hflip(uint data) const -> uint;
 
@@ -121,6 +124,12 @@ struct PPU : Thread, MMIO {
 
   uint px;
 
+  //mode 3 charged in one block; see PPU::main()
+  struct Batch {
+    bool active = false;
+    uint dma = 0;  //pixel at which an OAM DMA began during the block
+  } batch;
+
   struct Background {
     uint attr;
     uint data;
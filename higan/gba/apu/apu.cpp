@@ -17,32 +17,57 @@ auto APU::Enter() -> void {
   while(true) scheduler.synchronize(), apu.main();
 }
 
+//the PSG and Direct Sound channels are rendered lazily: the thread only wakes every Block clocks,
+//and register accesses and FIFO reloads first catch up to the CPU by calling update()
 auto APU::main() -> void {
+  update();
+  pending += Block;
+  step(Block);
+}
+
+auto APU::step(uint clocks) -> void {
+  Thread::step(clocks);
+  synchronize(cpu);
+}
+
+//render the PSG ticks that the CPU has already run past
+auto APU::update() -> void {
+  auto lag = Thread::clock() - min(cpu.Thread::clock(), Thread::clock());
+  uint clocks = pending - (lag ? (uint)min<uintmax>(pending, lag / scalar()) : 0);
+  if(uint ticks = clocks >> 3) {
+    render(ticks);
+    pending -= ticks << 3;
+  }
+}
+
+auto APU::render(uint ticks) -> void {
   //GBA clock runs at 16777216hz
   //GBA PSG channels run at 2097152hz
-  runsequencer();
-  step(8);
 
   //audio PWM output frequency and bit-rate are dependent upon amplitude setting:
   //0 = 9-bit @  32768hz
   //1 = 8-bit @  65536hz
   //2 = 7-bit @ 131072hz
   //3 = 6-bit @ 262144hz
+  uint rate = 64 >> regs.bias.amplitude;  //PSG ticks per output sample
+
+  while(ticks) {
+    uint length = min(ticks, rate - (clock & rate - 1));
+    runsequencer(length);
+    clock += length;
+    ticks -= length;
+    if((clock & rate - 1) == 0) sample();
+  }
+}
 
-  //dynamically changing the output frequency under emulation would be difficult;
-  //always run the output frequency at the maximum 262144hz
-  if(++clock & 7) return;
+auto APU::sample() -> void {
+  sequencer.sample();
+  fifo[0].sample();
+  fifo[1].sample();
 
   int lsample = regs.bias.level - 0x0200;
   int rsample = regs.bias.level - 0x0200;
 
-  //amplitude: 0 = 32768hz; 1 = 65536hz; 2 = 131072hz; 3 = 262144hz
-  if((clock & (63 >> (3 - regs.bias.amplitude))) == 0) {
-    sequencer.sample();
-    fifo[0].sample();
-    fifo[1].sample();
-  }
-
   lsample += sequencer.loutput;
   rsample += sequencer.routput;
 
@@ -69,18 +94,19 @@ auto APU::main() -> void {
   stream->sample((lsample << 5) / 32768.0, (rsample << 5) / 32768.0);
 }
 
-auto APU::step(uint clocks) -> void {
-  Thread::step(clocks);
-  synchronize(cpu);
+//the stream runs at the output frequency selected by the bias amplitude
+auto APU::updateFrequency() -> void {
+  stream->setFrequency(frequency() / (512 >> regs.bias.amplitude));
 }
 
 auto APU::power() -> void {
   create(APU::Enter, system.frequency());
-  stream = Emulator::audio.createStream(2, frequency() / 64.0);
+  stream = Emulator::audio.createStream(2, frequency() / 512.0);
   stream->addFilter(Emulator::Filter::Order::First, Emulator::Filter::Type::HighPass, 20.0);
   stream->addFilter(Emulator::Filter::Order::Second, Emulator::Filter::Type::LowPass, 20000.0, 3);
 
   clock = 0;
+  pending = 0;
   square1.power();
   square2.power();
   wave.power();
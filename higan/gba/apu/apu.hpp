@@ -4,16 +4,23 @@ struct APU : Thread, IO {
   static auto Enter() -> void;
   auto main() -> void;
   auto step(uint clocks) -> void;
+  auto update() -> void;
+  auto render(uint ticks) -> void;
+  auto sample() -> void;
 
   auto readIO(uint32 addr) -> uint8;
   auto writeIO(uint32 addr, uint8 byte) -> void;
   auto power() -> void;
 
-  auto runsequencer() -> void;
+  auto runsequencer(uint ticks) -> void;
+  auto updateFrequency() -> void;
 
   auto serialize(serializer&) -> void;
 
+  enum : uint { Block = 2048 };  //clocks the thread sleeps between renders
+
   uint clock;
+  uint pending;  //clocks the thread has stepped past but not yet rendered
 
   struct Registers {
     struct SoundBias {
@@ -58,7 +65,7 @@ struct APU : Thread, IO {
     uint3 phase;
     uint4 volume;
 
-    auto run() -> void;
+    auto run(uint ticks) -> void;
     auto clocklength() -> void;
     auto clockenvelope() -> void;
   };
@@ -97,7 +104,7 @@ struct APU : Thread, IO {
     uint4 patternsample;
     uint period;
 
-    auto run() -> void;
+    auto run(uint ticks) -> void;
     auto clocklength() -> void;
     auto read(uint addr) const -> uint8;
     auto write(uint addr, uint8 byte) -> void;
@@ -122,7 +129,7 @@ struct APU : Thread, IO {
     uint4 volume;
 
     auto divider() const -> uint;
-    auto run() -> void;
+    auto run(uint ticks) -> void;
     auto clocklength() -> void;
     auto clockenvelope() -> void;
     auto read(uint addr) const -> uint8;
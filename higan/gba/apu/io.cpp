@@ -1,4 +1,6 @@
 auto APU::readIO(uint32 addr) -> uint8 {
+  update();
+
   switch(addr) {
 
   //NR10
@@ -140,6 +142,8 @@ auto APU::readIO(uint32 addr) -> uint8 {
 }
 
 auto APU::writeIO(uint32 addr, uint8 data) -> void {
+  update();
+
   switch(addr) {
 
   //NR10
@@ -213,7 +217,10 @@ auto APU::writeIO(uint32 addr, uint8 data) -> void {
     return;
   case 0x0400'0089:
     regs.bias.level.bits(8,9) = data.bits(0,1);
-    regs.bias.amplitude       = data.bits(6,7);
+    if(regs.bias.amplitude != data.bits(6,7)) {
+      regs.bias.amplitude = data.bits(6,7);
+      updateFrequency();
+    }
     return;
 
   //WAVE_RAM0_L
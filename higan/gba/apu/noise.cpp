@@ -3,13 +3,19 @@ auto APU::Noise::divider() const -> uint {
   return divisor * 8;
 }
 
-auto APU::Noise::run() -> void {
-  if(period && --period == 0) {
-    period = divider() << frequency;
+auto APU::Noise::run(uint ticks) -> void {
+  if(period && ticks >= period) {
+    uint reload = divider() << frequency;
+    ticks -= period;
+    period = reload - ticks % reload;
     if(frequency < 14) {
-      bool bit = (lfsr ^ (lfsr >> 1)) & 1;
-      lfsr = (lfsr >> 1) ^ (bit << (narrowlfsr ? 6 : 14));
+      for(uint shifts = 1 + ticks / reload; shifts; shifts--) {
+        bool bit = (lfsr ^ (lfsr >> 1)) & 1;
+        lfsr = (lfsr >> 1) ^ (bit << (narrowlfsr ? 6 : 14));
+      }
     }
+  } else if(period) {
+    period -= ticks;
   }
 
   output = volume;
@@ -1,29 +1,35 @@
-auto APU::runsequencer() -> void {
+auto APU::runsequencer(uint ticks) -> void {
   auto& r = sequencer;
 
-  if(r.base == 0) {  //512hz
-    if(r.step == 0 || r.step == 2 || r.step == 4 || r.step == 6) {  //256hz
-      square1.clocklength();
-      square2.clocklength();
-      wave.clocklength();
-      noise.clocklength();
+  while(ticks) {
+    if(r.base == 0) {  //512hz
+      if(r.step == 0 || r.step == 2 || r.step == 4 || r.step == 6) {  //256hz
+        square1.clocklength();
+        square2.clocklength();
+        wave.clocklength();
+        noise.clocklength();
+      }
+      if(r.step == 2 || r.step == 6) {  //128hz
+        square1.clocksweep();
+      }
+      if(r.step == 7) {  //64hz
+        square1.clockenvelope();
+        square2.clockenvelope();
+        noise.clockenvelope();
+      }
+      r.step++;
     }
-    if(r.step == 2 || r.step == 6) {  //128hz
-      square1.clocksweep();
-    }
-    if(r.step == 7) {  //64hz
-      square1.clockenvelope();
-      square2.clockenvelope();
-      noise.clockenvelope();
-    }
-    r.step++;
-  }
-  r.base++;
 
-  if(square1.enable) square1.run();
-  if(square2.enable) square2.run();
-  if(wave.enable) wave.run();
-  if(noise.enable) noise.run();
+    //channels only change state on frame sequencer events, so run them in bulk up to the next one
+    uint length = min(ticks, 4096 - r.base);
+    r.base += length;
+    ticks -= length;
+
+    if(square1.enable) square1.run(length);
+    if(square2.enable) square2.run(length);
+    if(wave.enable) wave.run(length);
+    if(noise.enable) noise.run(length);
+  }
 }
 
 auto APU::Sequencer::sample() -> void {
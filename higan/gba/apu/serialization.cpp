@@ -2,6 +2,7 @@ auto APU::serialize(serializer& s) -> void {
   Thread::serialize(s);
 
   s.integer(clock);
+  s.integer(pending);
 
   s.integer(regs.bias.level);
   s.integer(regs.bias.amplitude);
@@ -107,4 +108,6 @@ auto APU::serialize(serializer& s) -> void {
     s.integer(f.renable);
     s.integer(f.timer);
   }
+
+  if(s.mode() == serializer::Load) updateFrequency();
 }
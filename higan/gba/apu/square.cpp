@@ -1,13 +1,17 @@
-auto APU::Square::run() -> void {
-  if(period && --period == 0) {
-    period = 2 * (2048 - frequency);
-    phase++;
+auto APU::Square::run(uint ticks) -> void {
+  if(period && ticks >= period) {
+    uint reload = 2 * (2048 - frequency);
+    ticks -= period;
+    phase += 1 + ticks / reload;
+    period = reload - ticks % reload;
     switch(duty) {
     case 0: signal = (phase == 6); break;  //_____-_
     case 1: signal = (phase >= 6); break;  //______--
     case 2: signal = (phase >= 4); break;  //____----
     case 3: signal = (phase <= 5); break;  //------__
     }
+  } else if(period) {
+    period -= ticks;
   }
 
   uint4 sample = volume;
@@ -1,8 +1,16 @@
-auto APU::Wave::run() -> void {
-  if(period && --period == 0) {
-    period = 1 * (2048 - frequency);
-    patternsample = pattern[patternbank << 5 | patternaddr++];
-    if(patternaddr == 0) patternbank ^= mode;
+auto APU::Wave::run(uint ticks) -> void {
+  if(period && ticks >= period) {
+    uint reload = 1 * (2048 - frequency);
+    ticks -= period;
+    period = reload - ticks % reload;
+    //one sample is fetched per reload; the bank toggles whenever the address wraps
+    uint samples = 1 + ticks / reload;
+    uint last = patternaddr + samples - 1;
+    patternsample = pattern[(patternbank ^ (mode & last >> 5)) << 5 | (last & 31)];
+    patternaddr = last + 1;
+    patternbank ^= mode & (last + 1) >> 5;
+  } else if(period) {
+    period -= ticks;
   }
 
   output = patternsample;
@@ -40,24 +40,21 @@ auto CPU::main() -> void {
 }
 
 auto CPU::step(uint clocks) -> void {
-  dma[0].waiting = max(0, dma[0].waiting - (int)clocks);
-  dma[1].waiting = max(0, dma[1].waiting - (int)clocks);
-  dma[2].waiting = max(0, dma[2].waiting - (int)clocks);
-  dma[3].waiting = max(0, dma[3].waiting - (int)clocks);
-
-  if(!context.dmaActive) {
-    context.dmaActive = true;
-    while(dma[0].run() | dma[1].run() | dma[2].run() | dma[3].run());
-    context.dmaActive = false;
+  if(dma[0].active || dma[1].active || dma[2].active || dma[3].active) {
+    dma[0].waiting = max(0, dma[0].waiting - (int)clocks);
+    dma[1].waiting = max(0, dma[1].waiting - (int)clocks);
+    dma[2].waiting = max(0, dma[2].waiting - (int)clocks);
+    dma[3].waiting = max(0, dma[3].waiting - (int)clocks);
+
+    if(!context.dmaActive) {
+      context.dmaActive = true;
+      while(dma[0].run() | dma[1].run() | dma[2].run() | dma[3].run());
+      context.dmaActive = false;
+    }
   }
 
-  for(auto _ : range(clocks)) {
-    timer[0].run();
-    timer[1].run();
-    timer[2].run();
-    timer[3].run();
-    context.clock++;
-  }
+  if(context.timerEvent - context.clock < clocks) runTimers(clocks);
+  context.clock += clocks;
 
   Thread::step(clocks);
   synchronize(ppu);
@@ -71,6 +68,8 @@ auto CPU::power() -> void {
 
   for(auto& byte : iwram) byte = 0x00;
   for(auto& byte : ewram) byte = 0x00;
+  iwramPages.markAll();
+  ewramPages.markAll();
 
   for(auto n : range(4)) dma[n] = {n};
   for(auto n : range(4)) timer[n] = {n};
@@ -82,6 +81,7 @@ auto CPU::power() -> void {
   memory = {};
   prefetch = {};
   context = {};
+  scheduleTimers();
 
   dma[0].source.resize(27); dma[0].latch.source.resize(27);
   dma[0].target.resize(27); dma[0].latch.target.resize(27);
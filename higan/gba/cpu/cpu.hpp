@@ -56,6 +56,8 @@ struct CPU : Processor::ARM7TDMI, Thread, IO {
   auto dmaHDMA() -> void;
 
   //timer.cpp
+  auto runTimers(uint clocks) -> void;
+  auto scheduleTimers() -> void;
   auto runFIFO(uint n) -> void;
 
   //serialization.cpp
@@ -63,12 +65,16 @@ struct CPU : Processor::ARM7TDMI, Thread, IO {
 
   uint8 iwram[ 32 * 1024];
   uint8 ewram[256 * 1024];
+  dirtypages iwramPages{ 32 * 1024};
+  dirtypages ewramPages{256 * 1024};
 
 //private:
   struct DMA {
     //dma.cpp
     inline auto run() -> bool;
     auto transfer() -> void;
+    auto burst() -> void;
+    auto advance() -> void;
 
     uint2 id;
 
@@ -98,15 +104,25 @@ struct CPU : Processor::ARM7TDMI, Thread, IO {
 
   struct Timer {
     //timer.cpp
-    inline auto run() -> void;
+    auto shift() const -> uint;
+    auto ticks(uint32_t clock) const -> uint32_t;
+    auto running() const -> bool;
+    auto counter() const -> uint16;
+    auto synchronize() -> void;
+    auto schedule() -> void;
+    auto run(uint32_t clock) -> void;
     auto step() -> void;
+    auto overflow() -> void;
 
     uint2 id;
 
     boolean pending;
 
-    uint16 period;
+    uint16 period;  //counter value at origin
     uint16 reload;
+    uint32 origin;  //first clock whose prescaler tick is not yet folded into period
+    uint32 event;   //clock of the next reload or overflow, when scheduled
+    boolean scheduled;
 
     uint2 frequency;
     uint1 cascade;
@@ -184,7 +200,6 @@ struct CPU : Processor::ARM7TDMI, Thread, IO {
   } memory;
 
   struct {
-    uint16 slot[8];
     uint32 addr;       //read location of slot buffer
     uint32 load;       //write location of slot buffer
     integer wait = 1;  //number of clocks before next slot load
@@ -195,6 +210,7 @@ struct CPU : Processor::ARM7TDMI, Thread, IO {
 
   struct Context {
     natural clock;
+    natural timerEvent;  //earliest scheduled timer event
     boolean halted;
     boolean stopped;
     boolean booted;  //set to true by the GBA BIOS
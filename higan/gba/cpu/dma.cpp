@@ -2,13 +2,13 @@ auto CPU::DMA::run() -> bool {
   if(!active || waiting) return false;
 
   transfer();
+  if(active) burst();
   if(irq) cpu.irq.flag |= CPU::Interrupt::DMA0 << id;
   if(drq && id == 3) cpu.irq.flag |= CPU::Interrupt::Cartridge;
   return true;
 }
 
 auto CPU::DMA::transfer() -> void {
-  uint seek = size ? 4 : 2;
   uint mode = size ? Word : Half;
   mode |= latch.length == length ? Nonsequential : Sequential;
 
@@ -39,6 +39,58 @@ auto CPU::DMA::transfer() -> void {
     cpu.set(mode, addr, data);
   }
 
+  advance();
+}
+
+//after the first unit of a transfer, units moving between side-effect free memories are copied
+//without stepping the CPU for each one; their combined wait states are charged in a single step.
+//the burst stops short of the next PPU or timer event, and of any other active channel,
+//so nothing can observe the transfer in a state that transferring unit by unit would not produce.
+auto CPU::DMA::burst() -> void {
+  for(auto& dma : cpu.dma) {
+    if(&dma != this && dma.active) return;
+  }
+
+  uint clocks = 0;
+  while(active && latch.length != length) {
+    uint mode = (size ? Word : Half) | Sequential;
+    uint32 source = latch.source & (size ? ~3 : ~1);
+    uint32 target = latch.target & (size ? ~3 : ~1);
+    uint sourceRegion = source >> 24;
+    uint targetRegion = target >> 24;
+    if(sourceRegion < 0x2 || sourceRegion == 0x4 || sourceRegion > 0xc) break;  //BIOS, I/O, EEPROM, SRAM
+    if(targetRegion < 0x2 || targetRegion == 0x4 || targetRegion > 0x7) break;  //BIOS, I/O, cartridge
+
+    uint cost = cpu._wait(mode, source) + cpu._wait(mode, target);
+    if(cpu.context.timerEvent - cpu.context.clock < clocks + cost) break;
+    if(cpu.Thread::clock() + (clocks + cost) * cpu.scalar() >= ppu.clock()) break;
+    clocks += cost;
+
+    switch(sourceRegion) {
+    case 0x2: data = cpu.readEWRAM(mode, source); break;
+    case 0x3: data = cpu.readIWRAM(mode, source); break;
+    case 0x5: data = ppu.readPRAM(mode, source); break;
+    case 0x6: data = ppu.readVRAM(mode, source); break;
+    case 0x7: data = ppu.readOAM(mode, source); break;
+    default:  data = cartridge.read(mode, source); break;
+    }
+
+    switch(targetRegion) {
+    case 0x2: cpu.writeEWRAM(mode, target, data); break;
+    case 0x3: cpu.writeIWRAM(mode, target, data); break;
+    case 0x5: ppu.writePRAM(mode, target, data); break;
+    case 0x6: ppu.writeVRAM(mode, target, data); break;
+    case 0x7: ppu.writeOAM(mode, target, data); break;
+    }
+
+    advance();
+  }
+  if(clocks) cpu.step(clocks);
+}
+
+auto CPU::DMA::advance() -> void {
+  uint seek = size ? 4 : 2;
+
   switch(sourceMode) {
   case 0: latch.source += seek; break;
   case 1: latch.source -= seek; break;
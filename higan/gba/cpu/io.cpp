@@ -24,8 +24,8 @@ auto CPU::readIO(uint32 addr) -> uint8 {
   );
 
   //TM0CNT_L, TM1CNT_L, TM2CNT_L, TM3CNT_L
-  case 0x0400'0100: case 0x0400'0104: case 0x0400'0108: case 0x0400'010c: return timer().period.byte(0);
-  case 0x0400'0101: case 0x0400'0105: case 0x0400'0109: case 0x0400'010d: return timer().period.byte(1);
+  case 0x0400'0100: case 0x0400'0104: case 0x0400'0108: case 0x0400'010c: return timer().counter().byte(0);
+  case 0x0400'0101: case 0x0400'0105: case 0x0400'0109: case 0x0400'010d: return timer().counter().byte(1);
 
   //TM0CNT_H, TM1CNT_H, TM2CNT_H, TM3CNT_H
   case 0x0400'0102: case 0x0400'0106: case 0x0400'010a: case 0x0400'010e: return (
@@ -251,6 +251,7 @@ auto CPU::writeIO(uint32 addr, uint8 data) -> void {
       dma().latch.length = dma().length;
     } else if(!dma().enable) {
       dma().active = false;
+      dma().waiting = 0;  //waiting only counts down while a channel is active
     }
     return;
   }
@@ -262,6 +263,7 @@ auto CPU::writeIO(uint32 addr, uint8 data) -> void {
   //TM0CNT_H, TM1CNT_H, TM2CNT_H, TM3CNT_H
   case 0x0400'0102: case 0x0400'0106: case 0x0400'010a: case 0x0400'010e: {
     bool enable = timer().enable;
+    timer().synchronize();
 
     timer().frequency = data.bits(0,1);
     timer().cascade   = data.bit (2);
@@ -271,6 +273,8 @@ auto CPU::writeIO(uint32 addr, uint8 data) -> void {
     if(!enable && timer().enable) {  //0->1 transition
       timer().pending = true;
     }
+    timer().schedule();
+    scheduleTimers();
     return;
   }
   case 0x0400'0103: case 0x0400'0107: case 0x0400'010b: case 0x0400'010f:
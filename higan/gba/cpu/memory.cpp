@@ -23,6 +23,7 @@ auto CPU::writeIWRAM(uint mode, uint32 addr, uint32 word) -> void {
   }
 
   iwram[addr & 0x7fff] = word;
+  iwramPages.mark(addr & 0x7fff);
 }
 
 auto CPU::readEWRAM(uint mode, uint32 addr) -> uint32 {
@@ -52,4 +53,5 @@ auto CPU::writeEWRAM(uint mode, uint32 addr, uint32 word) -> void {
   }
 
   ewram[addr & 0x3ffff] = word;
+  ewramPages.mark(addr & 0x3ffff);
 }
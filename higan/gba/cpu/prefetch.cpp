@@ -6,16 +6,18 @@ auto CPU::prefetchSync(uint32 addr) -> void {
   prefetch.wait = _wait(Half | Nonsequential, prefetch.load);
 }
 
+//slots only track how far ahead the buffer has loaded: cartridge ROM reads have no side effects,
+//so the halfword itself is fetched once prefetchRead() consumes its slot
 auto CPU::prefetchStep(uint clocks) -> void {
   step(clocks);
   if(!wait.prefetch || context.dmaActive) return;
 
-  while(!prefetch.full() && clocks--) {
-    if(--prefetch.wait) continue;
-    prefetch.slot[prefetch.load >> 1 & 7] = cartridge.read(Half, prefetch.load);
+  while(!prefetch.full() && clocks >= prefetch.wait) {
+    clocks -= prefetch.wait;
     prefetch.load += 2;
     prefetch.wait = _wait(Half | Sequential, prefetch.load);
   }
+  if(!prefetch.full()) prefetch.wait -= clocks;
 }
 
 auto CPU::prefetchWait() -> void {
@@ -31,7 +33,7 @@ auto CPU::prefetchRead() -> uint16 {
 
   if(prefetch.full()) prefetch.wait = _wait(Half | Sequential, prefetch.load);
 
-  uint16 half = prefetch.slot[prefetch.addr >> 1 & 7];
+  uint16 half = cartridge.read(Half, prefetch.addr);
   prefetch.addr += 2;
   return half;
 }
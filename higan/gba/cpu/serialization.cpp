@@ -2,8 +2,8 @@ auto CPU::serialize(serializer& s) -> void {
   ARM7TDMI::serialize(s);
   Thread::serialize(s);
 
-  s.array(iwram);
-  s.array(ewram);
+  s.pages(iwram, sizeof(iwram), iwramPages);
+  s.pages(ewram, sizeof(ewram), ewramPages);
 
   for(auto& dma : this->dma) {
     s.integer(dma.id);
@@ -31,6 +31,9 @@ auto CPU::serialize(serializer& s) -> void {
     s.boolean(timer.pending);
     s.integer(timer.period);
     s.integer(timer.reload);
+    s.integer(timer.origin);
+    s.integer(timer.event);
+    s.boolean(timer.scheduled);
     s.integer(timer.frequency);
     s.integer(timer.cascade);
     s.integer(timer.irq);
@@ -87,12 +90,12 @@ auto CPU::serialize(serializer& s) -> void {
   s.integer(memory.ewramWait);
   s.integer(memory.unknown2);
 
-  s.array(prefetch.slot);
   s.integer(prefetch.addr);
   s.integer(prefetch.load);
   s.integer(prefetch.wait);
 
   s.integer(context.clock);
+  s.integer(context.timerEvent);
   s.boolean(context.halted);
   s.boolean(context.stopped);
   s.boolean(context.booted);
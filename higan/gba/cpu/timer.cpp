@@ -1,33 +1,104 @@
-auto CPU::Timer::run() -> void {
+//timers are not clocked individually: a running timer's counter is derived from the CPU clock
+//whenever it is read, and the clock of its next event (reload or overflow) is computed in advance.
+//CPU::step() only calls into the timers when one of those events falls within the clocks stepped.
+
+//log2 of the prescaler: 1, 64, 256 or 1024 clocks per tick
+auto CPU::Timer::shift() const -> uint {
+  static const uint table[] = {0, 6, 8, 10};
+  return table[frequency];
+}
+
+//clocks [origin, clock) that fall on a prescaler boundary
+auto CPU::Timer::ticks(uint32_t clock) const -> uint32_t {
+  uint32_t mask = (1 << shift()) - 1;
+  uint32_t first = -(uint32_t)origin & mask;
+  uint32_t span = clock - origin;
+  if(span <= first) return 0;
+  return span - first + mask >> shift();
+}
+
+auto CPU::Timer::running() const -> bool {
+  return enable && !cascade && !pending;
+}
+
+auto CPU::Timer::counter() const -> uint16 {
+  if(!running()) return period;
+  return period + ticks(cpu.clock());
+}
+
+//folds elapsed ticks into period; must be called before the timer's control bits change
+auto CPU::Timer::synchronize() -> void {
+  period = counter();
+  origin = cpu.clock();
+}
+
+auto CPU::Timer::schedule() -> void {
+  scheduled = pending || running();
+  if(pending) {
+    event = origin;
+  } else if(running()) {
+    //the clock of the tick that carries period past 0xffff
+    uint32_t mask = (1 << shift()) - 1;
+    event = origin + (-(uint32_t)origin & mask) + ((0xffff - period) << shift());
+  }
+}
+
+//services this timer's event, which falls on the given clock
+auto CPU::Timer::run(uint32_t clock) -> void {
   if(pending) {
     pending = false;
     if(enable) period = reload;
-    return;
+  } else {
+    overflow();
   }
-
-  if(!enable || cascade) return;
-
-  static const uint mask[] = {0, 63, 255, 1023};
-  if((cpu.clock() & mask[frequency]) == 0) step();
+  origin = clock + 1;
+  schedule();
 }
 
+//cascade tick from the previous timer
 auto CPU::Timer::step() -> void {
-  if(++period == 0) {
-    period = reload;
+  if(++period == 0) overflow();
+}
+
+auto CPU::Timer::overflow() -> void {
+  period = reload;
 
-    if(irq) cpu.irq.flag |= CPU::Interrupt::Timer0 << id;
+  if(irq) cpu.irq.flag |= CPU::Interrupt::Timer0 << id;
 
-    if(apu.fifo[0].timer == id) cpu.runFIFO(0);
-    if(apu.fifo[1].timer == id) cpu.runFIFO(1);
+  if(apu.fifo[0].timer == id) cpu.runFIFO(0);
+  if(apu.fifo[1].timer == id) cpu.runFIFO(1);
 
-    if(id < 3 && cpu.timer[id + 1].enable && cpu.timer[id + 1].cascade) {
-      cpu.timer[id + 1].step();
+  if(id < 3 && cpu.timer[id + 1].enable && cpu.timer[id + 1].cascade) {
+    cpu.timer[id + 1].step();
+  }
+}
+
+//services every timer event within the next clocks, in clock order; ties resolve in timer order
+auto CPU::runTimers(uint clocks) -> void {
+  uint32_t clock = context.clock;
+  while(true) {
+    Timer* next = nullptr;
+    uint32_t distance = clocks;
+    for(auto& timer : this->timer) {
+      if(timer.scheduled && timer.event - clock < distance) next = &timer, distance = timer.event - clock;
     }
+    if(!next) break;
+    next->run(clock + distance);
+  }
+  scheduleTimers();
+}
+
+auto CPU::scheduleTimers() -> void {
+  //with no timer running, the event lands far enough ahead to be harmless when it is reached
+  uint32_t distance = ~0u >> 1;
+  for(auto& timer : this->timer) {
+    if(timer.scheduled) distance = min(distance, (uint32_t)(timer.event - context.clock));
   }
+  context.timerEvent = context.clock + distance;
 }
 
 auto CPU::runFIFO(uint n) -> void {
-  synchronize(apu);
+  apu.update();
   apu.fifo[n].read();
   if(apu.fifo[n].size > 16) return;
 
@@ -114,6 +114,22 @@ auto Interface::unserialize(serializer& s) -> bool {
   return system.unserialize(s);
 }
 
+auto Interface::serializeIncremental(uint base) -> serializer {
+  system.runToSave();
+  return system.serialize(true, base);
+}
+
+auto Interface::memoryRegions() -> vector<MemoryRegion> {
+  return {
+    {"EWRAM", (uint8_t*)cpu.ewram, sizeof(cpu.ewram), 0x0200'0000},
+    {"IWRAM", (uint8_t*)cpu.iwram, sizeof(cpu.iwram), 0x0300'0000},
+  };
+}
+
+auto Interface::profilerTargets() -> vector<ProfilerTarget> {
+  return {{"CPU", &cpu.profiler, &cpu}};
+}
+
 auto Interface::cap(const string& name) -> bool {
   if(name == "Blur Emulation") return true;
   if(name == "Color Emulation") return true;
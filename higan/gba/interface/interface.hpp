@@ -37,6 +37,10 @@ struct Interface : Emulator::Interface {
 
   auto serialize() -> serializer override;
   auto unserialize(serializer&) -> bool override;
+  auto serializeIncremental(uint base) -> serializer override;
+
+  auto memoryRegions() -> vector<MemoryRegion> override;
+  auto profilerTargets() -> vector<ProfilerTarget> override;
 
   auto cap(const string& name) -> bool override;
   auto get(const string& name) -> any override;
@@ -23,10 +23,12 @@ auto PPU::writeVRAM(uint mode, uint32 addr, uint32 word) -> void {
     vram[addr + 1] = word >>  8;
     vram[addr + 2] = word >> 16;
     vram[addr + 3] = word >> 24;
+    vramPages.mark(addr);
   } else if(mode & Half) {
     addr &= ~1;
     vram[addr + 0] = word >>  0;
     vram[addr + 1] = word >>  8;
+    vramPages.mark(addr);
   } else if(mode & Byte) {
     //8-bit writes to OBJ section of VRAM are ignored
     if(Background::IO::mode <= 2 && addr >= 0x10000) return;
@@ -35,6 +37,7 @@ auto PPU::writeVRAM(uint mode, uint32 addr, uint32 word) -> void {
     addr &= ~1;
     vram[addr + 0] = (uint8)word;
     vram[addr + 1] = (uint8)word;
+    vramPages.mark(addr);
   }
 }
 
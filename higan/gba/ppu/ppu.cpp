@@ -121,6 +121,7 @@ auto PPU::power() -> void {
   for(uint n = 0; n < 240 * 160; n++) output[n] = 0;
 
   for(uint n = 0; n < 96 * 1024; n++) vram[n] = 0x00;
+  vramPages.markAll();
   for(uint n = 0; n < 1024; n += 2) writePRAM(n, Half, 0x0000);
   for(uint n = 0; n < 1024; n += 2) writeOAM(n, Half, 0x0000);
 
@@ -29,6 +29,7 @@ struct PPU : Thread, IO {
   auto serialize(serializer&) -> void;
 
   uint8 vram[96 * 1024];
+  dirtypages vramPages{96 * 1024};
   uint16 pram[512];
   uint32* output;
 
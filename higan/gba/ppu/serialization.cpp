@@ -1,7 +1,7 @@
 auto PPU::serialize(serializer& s) -> void {
   Thread::serialize(s);
 
-  s.array(vram, 96 * 1024);
+  s.pages(vram, 96 * 1024, vramPages);
   s.array(pram, 512);
 
   s.integer(io.gameBoyColorMode);
@@ -1,7 +1,9 @@
-auto System::serialize() -> serializer {
+auto System::serialize(bool incremental, uint base) -> serializer {
   serializer s(_serializeSize);
+  if(incremental) s.setIncremental(base);
+  s.setGeneration(dirtypages::snapshot());
 
-  uint signature = 0x31545342;
+  uint signature = incremental ? 0x31495342 : 0x31545342;
   char version[16] = {0};
   char hash[64] = {0};
   char description[512] = {0};
@@ -28,10 +30,15 @@ auto System::unserialize(serializer& s) -> bool {
   s.array(hash);
   s.array(description);
 
-  if(signature != 0x31545342) return false;
+  if(signature != 0x31545342 && signature != 0x31495342) return false;
   if(string{version} != Emulator::SerializerVersion) return false;
 
-  power();
+  //incremental states only hold the pages that changed: they must be applied on top of their base state
+  if(signature == 0x31495342) {
+    s.setIncremental();
+  } else {
+    power();
+  }
   serializeAll(s);
   return true;
 }
@@ -32,7 +32,7 @@ struct System {
   auto configureVideoEffects() -> void;
 
   //serialization.cpp
-  auto serialize() -> serializer;
+  auto serialize(bool incremental = false, uint base = 0) -> serializer;
   auto unserialize(serializer&) -> bool;
 
   auto serialize(serializer&) -> void;
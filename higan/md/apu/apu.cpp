@@ -12,7 +12,7 @@ auto APU::Enter() -> void {
 
 auto APU::main() -> void {
   if(!state.enabled) {
-    return step(1);
+    return idle();
   }
 
   if(state.nmiLine) {
@@ -37,6 +37,24 @@ auto APU::synchronizing() const -> bool {
   return scheduler.synchronizing();
 }
 
+//a Z80 held in reset or off the bus only waits on the 68K: rather than stepping every clock,
+//sleep ahead until the 68K writes to the control registers, or the sleep runs out
+auto APU::idle() -> void {
+  state.sleep = Sleep;
+  step(Sleep);
+  wake();
+}
+
+//rewinds a sleeping Z80 to the first of its clocks after the 68K's, where stepping would have stopped
+auto APU::wake() -> void {
+  if(!state.sleep) return;
+  if(clock() > cpu.clock()) {
+    uintmax lead = (clock() - cpu.clock() - 1) / scalar();
+    setClock(clock() - min(lead, (uintmax)state.sleep) * scalar());
+  }
+  state.sleep = 0;
+}
+
 auto APU::setNMI(bool value) -> void {
   state.nmiLine = value;
 }
@@ -45,7 +63,13 @@ auto APU::setINT(bool value) -> void {
   state.intLine = value;
 }
 
+auto APU::request(bool value) -> void {
+  wake();
+  Z80::Bus::request(value);
+}
+
 auto APU::enable(bool value) -> void {
+  wake();
   //68K cannot disable the Z80 without bus access
   if(!bus->granted() && !value) return;
   if(state.enabled && !value) reset();
@@ -6,6 +6,8 @@ struct APU : Processor::Z80, Processor::Z80::Bus, Thread {
   auto main() -> void;
   auto step(uint clocks) -> void override;
   auto synchronizing() const -> bool override;
+  auto idle() -> void override;
+  auto wake() -> void;
 
   auto enable(bool) -> void;
   auto power(bool reset) -> void;
@@ -14,6 +16,8 @@ struct APU : Processor::Z80, Processor::Z80::Bus, Thread {
   auto setNMI(bool value) -> void;
   auto setINT(bool value) -> void;
 
+  auto request(bool value) -> void override;
+
   //bus.cpp
   auto read(uint16 addr) -> uint8 override;
   auto write(uint16 addr, uint8 data) -> void override;
@@ -25,6 +29,8 @@ struct APU : Processor::Z80, Processor::Z80::Bus, Thread {
   auto serialize(serializer&) -> void;
 
 private:
+  enum : uint { Sleep = 4096 };  //clocks an idle Z80 sleeps before checking in again
+
   uint8 ram[8 * 1024];
 
   struct IO {
@@ -35,6 +41,7 @@ private:
     uint1 enabled;
     uint1 nmiLine;
     uint1 intLine;
+    uint32 sleep;  //clocks stepped ahead while idle
   } state;
 };
 
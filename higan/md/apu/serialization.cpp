@@ -10,4 +10,5 @@ auto APU::serialize(serializer& s) -> void {
   s.integer(state.enabled);
   s.integer(state.nmiLine);
   s.integer(state.intLine);
+  s.integer(state.sleep);
 }
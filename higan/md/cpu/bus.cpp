@@ -43,6 +43,7 @@ auto CPU::writeByte(uint24 addr, uint16 data) -> void {
   if(addr >= 0xc00010 && addr <= 0xc00017) return psg.write(data);
   if(addr >= 0xe00000 && addr <= 0xffffff) {
     ram[addr & 0xffff] = data;
+    ramPages.mark(addr & 0xffff);
     return;
   }
 }
@@ -60,6 +61,8 @@ auto CPU::writeWord(uint24 addr, uint16 data) -> void {
   if(addr >= 0xe00000 && addr <= 0xffffff) {
     ram[addr + 0 & 0xffff] = data >> 8;
     ram[addr + 1 & 0xffff] = data >> 0;
+    ramPages.mark(addr + 0 & 0xffff);
+    ramPages.mark(addr + 1 & 0xffff);
     return;
   }
 }
@@ -38,7 +38,7 @@ auto CPU::main() -> void {
 
 auto CPU::step(uint clocks) -> void {
   while(wait) {
-    Thread::step(1);
+    Thread::step(stalled());
     synchronize();
   }
 
@@ -46,6 +46,17 @@ auto CPU::step(uint clocks) -> void {
   synchronize();
 }
 
+//clocks the 68K remains stalled for: a DMA load holds it until the VDP transfers its last word,
+//one word per VDP clock; stepping straight there skips synchronizing every thread on each clock
+auto CPU::stalled() const -> uint {
+  if(wait != Wait::VDP_DMA) return 1;
+  //a length of zero is decremented to 0xffff before it is tested, and so transfers 0x10000 words
+  uint words = vdp.dma.io.length ? (uint)vdp.dma.io.length : 0x10000;
+  intmax end = (intmax)(vdp.clock() - clock()) + (intmax)(words - 1) * vdp.scalar();
+  if(end <= 0) return 1;
+  return (end + scalar() - 1) / scalar();
+}
+
 auto CPU::synchronize() -> void {
   synchronize(apu);
   synchronize(vdp);
@@ -86,6 +97,7 @@ auto CPU::power(bool reset) -> void {
   create(CPU::Enter, system.frequency() / 7.0);
 
   if(!reset) memory::fill(ram, sizeof ram);
+  ramPages.markAll();
 
   io = {};
   io.version = tmssEnable;
@@ -13,6 +13,7 @@ struct CPU : Processor::M68K, Processor::M68K::Bus, Thread {
   static auto Enter() -> void;
   auto main() -> void;
   auto step(uint clocks) -> void override;
+  auto stalled() const -> uint;
   auto synchronize() -> void;
 
   auto raise(Interrupt) -> void;
@@ -36,6 +37,7 @@ struct CPU : Processor::M68K, Processor::M68K::Bus, Thread {
 
 private:
   uint8 ram[64 * 1024];
+  dirtypages ramPages{64 * 1024};
   uint8 tmss[2 * 1024];
   uint1 tmssEnable;
 
@@ -49,6 +51,8 @@ private:
     uint32 interruptLine;
     uint32 interruptPending;
   } state;
+
+  friend class Interface;
 };
 
 extern CPU cpu;
@@ -143,10 +143,23 @@ auto Interface::unserialize(serializer& s) -> bool {
   return system.unserialize(s);
 }
 
+auto Interface::serializeIncremental(uint base) -> serializer {
+  system.runToSave();
+  return system.serialize(true, base);
+}
+
 auto Interface::cheatSet(const string_vector& list) -> void {
   cheat.assign(list);
 }
 
+auto Interface::memoryRegions() -> vector<MemoryRegion> {
+  return {{"Work RAM", (uint8_t*)cpu.ram, sizeof(cpu.ram), 0xff0000}};
+}
+
+auto Interface::profilerTargets() -> vector<ProfilerTarget> {
+  return {{"CPU", &cpu.profiler, &cpu}, {"APU", &apu.profiler, &apu}};
+}
+
 auto Interface::cap(const string& name) -> bool {
   return false;
 }
@@ -43,8 +43,11 @@ struct Interface : Emulator::Interface {
 
   auto serialize() -> serializer override;
   auto unserialize(serializer&) -> bool override;
+  auto serializeIncremental(uint base) -> serializer override;
 
   auto cheatSet(const string_vector& list) -> void override;
+  auto memoryRegions() -> vector<MemoryRegion> override;
+  auto profilerTargets() -> vector<ProfilerTarget> override;
 
   auto cap(const string& name) -> bool override;
   auto get(const string& name) -> any override;
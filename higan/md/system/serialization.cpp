@@ -15,10 +15,12 @@ auto System::serializeInit() -> void {
   information.serializeSize = s.size();
 }
 
-auto System::serialize() -> serializer {
+auto System::serialize(bool incremental, uint base) -> serializer {
   serializer s{information.serializeSize};
+  if(incremental) s.setIncremental(base);
+  s.setGeneration(dirtypages::snapshot());
 
-  uint signature = 0x31545342;
+  uint signature = incremental ? 0x31495342 : 0x31545342;
   char version[16] = {0};
   char hash[64] = {0};
   char description[512] = {0};
@@ -45,10 +47,15 @@ auto System::unserialize(serializer& s) -> bool {
   s.array(hash);
   s.array(description);
 
-  if(signature != 0x31545342) return false;
+  if(signature != 0x31545342 && signature != 0x31495342) return false;
   if(string{version} != Emulator::SerializerVersion) return false;
 
-  power(/* reset = */ false);
+  //incremental states only hold the pages that changed: they must be applied on top of their base state
+  if(signature == 0x31495342) {
+    s.setIncremental();
+  } else {
+    power(/* reset = */ false);
+  }
   serializeAll(s);
   return true;
 }
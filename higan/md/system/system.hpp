@@ -19,7 +19,7 @@ struct System {
 
   //serialization.cpp
   auto serializeInit() -> void;
-  auto serialize() -> serializer;
+  auto serialize(bool incremental = false, uint base = 0) -> serializer;
   auto unserialize(serializer&) -> bool;
   auto serializeAll(serializer&) -> void;
   auto serialize(serializer&) -> void;
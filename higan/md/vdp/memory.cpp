@@ -4,6 +4,7 @@ auto VDP::VRAM::read(uint15 address) const -> uint16 {
 
 auto VDP::VRAM::write(uint15 address, uint16 data) -> void {
   memory[address] = data;
+  pages.mark(address);
   if(address < vdp.sprite.io.attributeAddress) return;
   if(address > vdp.sprite.io.attributeAddress + 319) return;
   vdp.sprite.write(address - vdp.sprite.io.attributeAddress, data);
@@ -100,7 +100,7 @@ auto VDP::Sprite::serialize(serializer& s) -> void {
 }
 
 auto VDP::VRAM::serialize(serializer& s) -> void {
-  s.array(memory);
+  s.pages(memory, 32768, pages);
 }
 
 auto VDP::VSRAM::serialize(serializer& s) -> void {
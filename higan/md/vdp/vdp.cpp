@@ -88,6 +88,7 @@ auto VDP::power(bool reset) -> void {
 
   if(!reset) {
     for(auto& data : vram.memory) data = 0;
+    vram.pages.markAll();
     for(auto& data : vsram.memory) data = 0;
     for(auto& data : cram.memory) data = 0;
   }
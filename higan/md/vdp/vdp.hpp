@@ -167,6 +167,7 @@ private:
     auto serialize(serializer&) -> void;
 
     uint16 memory[32768];
+    dirtypages pages{32768};
   } vram;
 
   //vertical scroll RAM
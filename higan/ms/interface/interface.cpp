@@ -51,6 +51,10 @@ auto Interface::cheatSet(const string_vector& list) -> void {
   cheat.assign(list);
 }
 
+auto Interface::profilerTargets() -> vector<ProfilerTarget> {
+  return {{"CPU", &cpu.profiler, &cpu}};
+}
+
 auto Interface::cap(const string& name) -> bool {
   return false;
 }
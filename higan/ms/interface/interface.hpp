@@ -39,6 +39,7 @@ struct Interface : Emulator::Interface {
   auto unserialize(serializer&) -> bool override;
 
   auto cheatSet(const string_vector&) -> void override;
+  auto profilerTargets() -> vector<ProfilerTarget> override;
 
   auto cap(const string& name) -> bool override;
   auto get(const string& name) -> any override;
@@ -3,27 +3,50 @@ auto PSG::Channel::power(uint id) -> void {
   memory::fill(&io, sizeof(IO));
 }
 
-auto PSG::Channel::run() -> void {
-  if(!io.enable) return sample(0);
-
-  if(!io.direct && --io.wavePeriod == 0) {
-    io.wavePeriod = io.waveFrequency;
-    io.waveOffset++;
-    io.waveSample = io.waveBuffer[io.waveOffset];
-  }
+//advances the channel by clocks, returning the sum of its output over them
+auto PSG::Channel::run(uint clocks) -> uint {
+  if(!io.enable) return io.output = 0;
 
+  //direct (DDA) mode holds the last sample written
+  uint sum = io.direct ? io.waveSample * clocks : wave(clocks);
   if(!io.noiseEnable) {
-    return sample(io.waveSample);
+    io.output = io.waveSample;
+    return sum;
   }
 
-  if(--io.noisePeriod == 0) {
+  sum = 0;
+  while(true) {
+    //the period counter wraps through 4096 clocks when reloaded with zero
+    uint period = io.noisePeriod ? (uint)io.noisePeriod : 4096;
+    if(clocks < period) {
+      io.noisePeriod -= clocks;
+      sum += io.noiseSample * clocks;
+      break;
+    }
+    clocks -= period;
+    sum += io.noiseSample * (period - 1);
     io.noisePeriod = ~io.noiseFrequency << 7;
     io.noiseSample = nall::random() & 1 ? ~0 : 0;
+    sum += io.noiseSample;
   }
-
-  return sample(io.noiseSample);
+  io.output = io.noiseSample;
+  return sum;
 }
 
-auto PSG::Channel::sample(uint5 sample) -> void {
-  io.output = sample;
+//steps the wavetable through clocks, returning the sum of its samples over them
+auto PSG::Channel::wave(uint clocks) -> uint {
+  uint sum = 0;
+  while(true) {
+    uint period = io.wavePeriod ? (uint)io.wavePeriod : 4096;
+    if(clocks < period) {
+      io.wavePeriod -= clocks;
+      return sum + io.waveSample * clocks;
+    }
+    clocks -= period;
+    sum += io.waveSample * (period - 1);
+    io.wavePeriod = io.waveFrequency;
+    io.waveOffset++;
+    io.waveSample = io.waveBuffer[io.waveOffset];
+    sum += io.waveSample;
+  }
 }
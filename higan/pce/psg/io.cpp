@@ -1,4 +1,6 @@
 auto PSG::write(uint4 addr, uint8 data) -> void {
+  update();
+
   if(addr == 0x00) {
     io.channel = data.bits(0,2);
   }
@@ -11,7 +11,31 @@ auto PSG::Enter() -> void {
   while(true) scheduler.synchronize(), psg.main();
 }
 
+//channels are rendered lazily: the thread only wakes every Block clocks,
+//and register writes first catch up to the CPU by calling update()
 auto PSG::main() -> void {
+  update();
+  pending += Block;
+  step(Block);
+}
+
+auto PSG::step(uint clocks) -> void {
+  Thread::step(clocks);
+  synchronize(cpu);
+}
+
+//render the clocks that the CPU has already run past
+auto PSG::update() -> void {
+  auto lag = clock() - min(cpu.clock(), clock());
+  uint clocks = pending - (lag ? (uint)min<uintmax>(pending, lag / scalar()) : 0);
+  if(clocks) {
+    render(clocks);
+    pending -= clocks;
+  }
+}
+
+//each output sample averages Rate clocks of the mixed channels
+auto PSG::render(uint clocks) -> void {
   static const uint5 volumeScale[16] = {
     0x00, 0x03, 0x05, 0x07, 0x09, 0x0b, 0x0d, 0x0f,
     0x10, 0x13, 0x15, 0x17, 0x19, 0x1b, 0x1d, 0x1f,
@@ -20,8 +44,8 @@ auto PSG::main() -> void {
   uint5 lmal = volumeScale[io.volumeLeft];
   uint5 rmal = volumeScale[io.volumeRight];
 
-  double outputLeft  = 0.0;
-  double outputRight = 0.0;
+  double scalarLeft[6];
+  double scalarRight[6];
 
   for(auto C : range(6)) {
     uint5  al = channel[C].io.volume;
@@ -31,30 +55,44 @@ auto PSG::main() -> void {
     uint5 volumeLeft  = min(0x1f, (0x1f - lmal) + (0x1f - lal) + (0x1f - al));
     uint5 volumeRight = min(0x1f, (0x1f - rmal) + (0x1f - ral) + (0x1f - al));
 
-    channel[C].run();
     if(C == 1 && io.lfoEnable) {
       //todo: frequency modulation of channel 0 using channel 1's output
+      scalarLeft[C] = scalarRight[C] = 0.0;
     } else {
-      outputLeft  += channel[C].io.output * volumeScalar[volumeLeft];
-      outputRight += channel[C].io.output * volumeScalar[volumeRight];
+      scalarLeft[C]  = volumeScalar[volumeLeft];
+      scalarRight[C] = volumeScalar[volumeRight];
     }
   }
 
-  stream->sample(sclamp<16>(outputLeft) / 32768.0, sclamp<16>(outputRight) / 32768.0);
-  step(1);
-}
+  while(clocks) {
+    uint length = min(clocks, Rate - phase);
+    for(auto C : range(6)) {
+      uint sum = channel[C].run(length);
+      outputLeft  += sum * scalarLeft[C];
+      outputRight += sum * scalarRight[C];
+    }
+    clocks -= length;
 
-auto PSG::step(uint clocks) -> void {
-  Thread::step(clocks);
-  synchronize(cpu);
+    if((phase += length) == Rate) {
+      stream->sample(sclamp<16>(outputLeft / Rate) / 32768.0, sclamp<16>(outputRight / Rate) / 32768.0);
+      outputLeft  = 0.0;
+      outputRight = 0.0;
+      phase = 0;
+    }
+  }
 }
 
 auto PSG::power() -> void {
   create(PSG::Enter, system.colorburst());
-  stream = Emulator::audio.createStream(2, frequency());
+  stream = Emulator::audio.createStream(2, frequency() / Rate);
   stream->addFilter(Emulator::Filter::Order::First, Emulator::Filter::Type::HighPass, 20.0);
   stream->addFilter(Emulator::Filter::Order::Second, Emulator::Filter::Type::LowPass, 20000.0, 3);
 
+  pending = 0;
+  phase = 0;
+  outputLeft = 0.0;
+  outputRight = 0.0;
+
   memory::fill(&io, sizeof(IO));
   for(auto C : range(6)) channel[C].power(C);
 
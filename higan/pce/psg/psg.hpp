@@ -6,6 +6,8 @@ struct PSG : Thread {
   static auto Enter() -> void;
   auto main() -> void;
   auto step(uint clocks) -> void;
+  auto update() -> void;
+  auto render(uint clocks) -> void;
 
   auto power() -> void;
 
@@ -16,6 +18,16 @@ struct PSG : Thread {
   auto serialize(serializer&) -> void;
 
 private:
+  enum : uint {
+    Block = 4096,  //clocks the thread sleeps between renders
+    Rate  =   16,  //clocks averaged into each output sample
+  };
+
+  uint pending;  //clocks the thread has stepped past but not yet rendered
+  uint phase;    //clocks accumulated into the current output sample
+  double outputLeft;   //not serialized: a load drops at most one partial sample
+  double outputRight;
+
   struct IO {
     uint3 channel;
     uint4 volumeLeft;
@@ -28,8 +40,8 @@ private:
   struct Channel {
     //channel.cpp
     auto power(uint id) -> void;
-    auto run() -> void;
-    auto sample(uint5 sample) -> void;
+    auto run(uint clocks) -> uint;
+    auto wave(uint clocks) -> uint;
 
     //io.cpp
     auto write(uint4 addr, uint8 data) -> void;
@@ -1,5 +1,7 @@
 auto PSG::serialize(serializer& s) -> void {
   Thread::serialize(s);
+  s.integer(pending);
+  s.integer(phase);
 
   s.integer(io.channel);
   s.integer(io.volumeLeft);
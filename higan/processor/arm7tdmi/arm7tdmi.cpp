@@ -12,12 +12,14 @@ namespace Processor {
 #include "serialization.cpp"
 #include "disassembler.cpp"
 
-ARM7TDMI::ARM7TDMI() {
-  armInitialize();
-  thumbInitialize();
-}
-
 auto ARM7TDMI::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 4096 + 65536);
+  #endif
+
+  //every opcode is bound once built, so an empty slot means the tables have not been built yet
+  if(!thumbInstruction[0]) armInitialize(), thumbInitialize();
+
   processor = {};
   processor.r15.modify = [&] { pipeline.reload = true; };
   pipeline = {};
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct ARM7TDMI {
@@ -23,7 +26,6 @@ struct ARM7TDMI {
   virtual auto set(uint mode, uint32 address, uint32 word) -> void = 0;
 
   //arm7tdmi.cpp
-  ARM7TDMI();
   auto power() -> void;
 
   //registers.cpp
@@ -118,6 +120,13 @@ struct ARM7TDMI {
   auto disassemble(maybe<uint32> pc = nothing, maybe<boolean> thumb = nothing) -> string;
   auto disassembleRegisters() -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = ARM decode index (0-4095), or 4096 + THUMB opcode
+  #endif
+
+  Emulator::Profiler profiler;
+
   struct GPR {
     inline operator uint32_t() const { return data; }
     inline auto operator=(const GPR& value) -> GPR& { return operator=(value.data); }
@@ -148,14 +157,14 @@ struct ARM7TDMI {
     }
 
     inline auto operator=(uint32 data) -> PSR& {
-      m = data.bits(0,4);
-      t = data.bit(5);
-      f = data.bit(6);
-      i = data.bit(7);
-      v = data.bit(28);
-      c = data.bit(29);
-      z = data.bit(30);
-      n = data.bit(31);
+      m = data.bits<0,4>();
+      t = data.bit<5>();
+      f = data.bit<6>();
+      i = data.bit<7>();
+      v = data.bit<28>();
+      c = data.bit<29>();
+      z = data.bit<30>();
+      n = data.bit<31>();
       return *this;
     }
 
@@ -226,6 +235,7 @@ struct ARM7TDMI {
   boolean carry;
   boolean irq;
 
+  //built on first power(), keeping static construction cheap
   function<auto (uint32 opcode) -> void> armInstruction[4096];
   function<auto () -> void> thumbInstruction[65536];
 
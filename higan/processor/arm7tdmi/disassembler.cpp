@@ -221,20 +221,20 @@ auto ARM7TDMI::armDisassembleMoveToStatusFromImmediate
 (uint8 immediate, uint4 rotate, uint4 field, uint1 mode) -> string {
   uint32 data = immediate >> (rotate << 1) | immediate << 32 - (rotate << 1);
   return {"msr", _c, " ", mode ? "spsr:" : "cpsr:",
-    field.bit(0) ? "c" : "",
-    field.bit(1) ? "x" : "",
-    field.bit(2) ? "s" : "",
-    field.bit(3) ? "f" : "",
+    field.bit<0>() ? "c" : "",
+    field.bit<1>() ? "x" : "",
+    field.bit<2>() ? "s" : "",
+    field.bit<3>() ? "f" : "",
     ",#0x", hex(data, 8L)};
 }
 
 auto ARM7TDMI::armDisassembleMoveToStatusFromRegister
 (uint4 m, uint4 field, uint1 mode) -> string {
   return {"msr", _c, " ", mode ? "spsr:" : "cpsr:",
-    field.bit(0) ? "c" : "",
-    field.bit(1) ? "x" : "",
-    field.bit(2) ? "s" : "",
-    field.bit(3) ? "f" : "",
+    field.bit<0>() ? "c" : "",
+    field.bit<1>() ? "x" : "",
+    field.bit<2>() ? "s" : "",
+    field.bit<3>() ? "f" : "",
     ",", _r[m]};
 }
 
@@ -411,3 +411,11 @@ auto ARM7TDMI::thumbDisassembleUndefined
 #undef _move
 #undef _comp
 #undef _save
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto ARM7TDMI::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    return disassemble(maybe<uint32>{address}, maybe<boolean>{key >= 4096});
+  });
+}
+#endif
@@ -18,6 +18,7 @@ auto ARM7TDMI::fetch() -> void {
 }
 
 auto ARM7TDMI::instruction() -> void {
+  HISTOGRAM_SAMPLE(0);
   uint mask = !cpsr().t ? 3 : 1;
   uint size = !cpsr().t ? Word : Half;
 
@@ -37,11 +38,15 @@ auto ARM7TDMI::instruction() -> void {
   }
 
   opcode = pipeline.execute.instruction;
+  if(profiler) profiler.instruction(pipeline.execute.address);
+  HISTOGRAM_ADDRESS(pipeline.execute.address);
   if(!pipeline.execute.thumb) {
-    if(!TST(opcode.bits(28,31))) return;
     uint12 index = (opcode & 0x0ff00000) >> 16 | (opcode & 0x000000f0) >> 4;
+    HISTOGRAM_KEY(index);
+    if(!TST(opcode.bits<28,31>())) return;
     armInstruction[index](opcode);
   } else {
+    HISTOGRAM_KEY(4096 + (uint16)opcode);
     thumbInstruction[(uint16)opcode]();
   }
 }
@@ -69,8 +74,8 @@ auto ARM7TDMI::armInitialize() -> void {
     std::integral_constant<uint32_t, bit::test(s)>::value
 
   #define arguments \
-    opcode.bits( 0,23),  /* displacement */ \
-    opcode.bit (24)      /* link */
+    opcode.bits< 0,23>(),  /* displacement */ \
+    opcode.bit <24>()      /* link */
   for(uint4 displacementLo : range(16))
   for(uint4 displacementHi : range(16))
   for(uint1 link : range(2)) {
@@ -81,7 +86,7 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3)   /* m */
+    opcode.bits< 0, 3>()   /* m */
   {
     auto opcode = pattern(".... 0001 0010 ---- ---- ---- 0001 ????");
     bind(opcode, BranchExchangeRegister);
@@ -89,12 +94,12 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 7),  /* immediate */ \
-    opcode.bits( 8,11),  /* shift */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* save */ \
-    opcode.bits(21,24)   /* mode */
+    opcode.bits< 0, 7>(),  /* immediate */ \
+    opcode.bits< 8,11>(),  /* shift */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* save */ \
+    opcode.bits<21,24>()   /* mode */
   for(uint4 shiftHi : range(16))
   for(uint1 save : range(2))
   for(uint4 mode : range(16)) {
@@ -105,13 +110,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits( 5, 6),  /* type */ \
-    opcode.bits( 7,11),  /* shift */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* save */ \
-    opcode.bits(21,24)   /* mode */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits< 5, 6>(),  /* type */ \
+    opcode.bits< 7,11>(),  /* shift */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* save */ \
+    opcode.bits<21,24>()   /* mode */
   for(uint2 type : range(4))
   for(uint1 shiftLo : range(2))
   for(uint1 save : range(2))
@@ -123,13 +128,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits( 5, 6),  /* type */ \
-    opcode.bits( 8,11),  /* s */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* save */ \
-    opcode.bits(21,24)   /* mode */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits< 5, 6>(),  /* type */ \
+    opcode.bits< 8,11>(),  /* s */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* save */ \
+    opcode.bits<21,24>()   /* mode */
   for(uint2 type : range(4))
   for(uint1 save : range(2))
   for(uint4 mode : range(16)) {
@@ -140,13 +145,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3) << 0 | opcode.bits( 8,11) << 4,  /* immediate */ \
-    opcode.bit ( 5),     /* half */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0, 3>() << 0 | opcode.bits< 8,11>() << 4,  /* immediate */ \
+    opcode.bit < 5>(),     /* half */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint1 half : range(2))
   for(uint1 writeback : range(2))
   for(uint1 up : range(2))
@@ -157,13 +162,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bit ( 5),     /* half */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bit < 5>(),     /* half */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint1 half : range(2))
   for(uint1 writeback : range(2))
   for(uint1 up : range(2))
@@ -174,10 +179,10 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (22)      /* byte */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <22>()      /* byte */
   for(uint1 byte : range(2)) {
     auto opcode = pattern(".... 0001 0?00 ???? ???? ---- 1001 ????") | byte << 22;
     bind(opcode, MemorySwap);
@@ -185,13 +190,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3) << 0 | opcode.bits( 8,11) << 4,  /* immediate */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* mode */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0, 3>() << 0 | opcode.bits< 8,11>() << 4,  /* immediate */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* mode */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint1 mode : range(2))
   for(uint1 writeback : range(2))
   for(uint1 up : range(2))
@@ -202,13 +207,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* mode */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* mode */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint1 mode : range(2))
   for(uint1 writeback : range(2))
   for(uint1 up : range(2))
@@ -219,14 +224,14 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0,11),  /* immediate */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* mode */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (22),     /* byte */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0,11>(),  /* immediate */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* mode */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <22>(),     /* byte */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint4 immediatePart : range(16))
   for(uint1 mode : range(2))
   for(uint1 writeback : range(2))
@@ -240,13 +245,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0,15),  /* list */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* mode */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (22),     /* type */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0,15>(),  /* list */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* mode */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <22>(),     /* type */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint4 listPart : range(16))
   for(uint1 mode : range(2))
   for(uint1 writeback : range(2))
@@ -260,16 +265,16 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits( 5, 6),  /* type */ \
-    opcode.bits( 7,11),  /* shift */ \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bits(16,19),  /* n */ \
-    opcode.bit (20),     /* mode */ \
-    opcode.bit (21),     /* writeback */ \
-    opcode.bit (22),     /* byte */ \
-    opcode.bit (23),     /* up */ \
-    opcode.bit (24)      /* pre */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits< 5, 6>(),  /* type */ \
+    opcode.bits< 7,11>(),  /* shift */ \
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bits<16,19>(),  /* n */ \
+    opcode.bit <20>(),     /* mode */ \
+    opcode.bit <21>(),     /* writeback */ \
+    opcode.bit <22>(),     /* byte */ \
+    opcode.bit <23>(),     /* up */ \
+    opcode.bit <24>()      /* pre */
   for(uint2 type : range(4))
   for(uint1 shiftLo : range(2))
   for(uint1 mode : range(2))
@@ -284,8 +289,8 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits(12,15),  /* d */ \
-    opcode.bit (22)      /* mode */
+    opcode.bits<12,15>(),  /* d */ \
+    opcode.bit <22>()      /* mode */
   for(uint1 mode : range(2)) {
     auto opcode = pattern(".... 0001 0?00 ---- ???? ---- 0000 ----") | mode << 22;
     bind(opcode, MoveToRegisterFromStatus);
@@ -293,10 +298,10 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 7),  /* immediate */ \
-    opcode.bits( 8,11),  /* rotate */ \
-    opcode.bits(16,19),  /* field */ \
-    opcode.bit (22)      /* mode */
+    opcode.bits< 0, 7>(),  /* immediate */ \
+    opcode.bits< 8,11>(),  /* rotate */ \
+    opcode.bits<16,19>(),  /* field */ \
+    opcode.bit <22>()      /* mode */
   for(uint4 immediateHi : range(16))
   for(uint1 mode : range(2)) {
     auto opcode = pattern(".... 0011 0?10 ???? ---- ???? ???? ????") | immediateHi << 4 | mode << 22;
@@ -305,9 +310,9 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits(16,19),  /* field */ \
-    opcode.bit (22)      /* mode */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits<16,19>(),  /* field */ \
+    opcode.bit <22>()      /* mode */
   for(uint1 mode : range(2)) {
     auto opcode = pattern(".... 0001 0?10 ???? ---- ---- 0000 ????") | mode << 22;
     bind(opcode, MoveToStatusFromRegister);
@@ -315,12 +320,12 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits( 8,11),  /* s */ \
-    opcode.bits(12,15),  /* n */ \
-    opcode.bits(16,19),  /* d */ \
-    opcode.bit (20),     /* save */ \
-    opcode.bit (21)      /* accumulate */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits< 8,11>(),  /* s */ \
+    opcode.bits<12,15>(),  /* n */ \
+    opcode.bits<16,19>(),  /* d */ \
+    opcode.bit <20>(),     /* save */ \
+    opcode.bit <21>()      /* accumulate */
   for(uint1 save : range(2))
   for(uint1 accumulate : range(2)) {
     auto opcode = pattern(".... 0000 00?? ???? ???? ???? 1001 ????") | save << 20 | accumulate << 21;
@@ -329,13 +334,13 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0, 3),  /* m */ \
-    opcode.bits( 8,11),  /* s */ \
-    opcode.bits(12,15),  /* l */ \
-    opcode.bits(16,19),  /* h */ \
-    opcode.bit (20),     /* save */ \
-    opcode.bit (21),     /* accumulate */ \
-    opcode.bit (22)      /* sign */
+    opcode.bits< 0, 3>(),  /* m */ \
+    opcode.bits< 8,11>(),  /* s */ \
+    opcode.bits<12,15>(),  /* l */ \
+    opcode.bits<16,19>(),  /* h */ \
+    opcode.bit <20>(),     /* save */ \
+    opcode.bit <21>(),     /* accumulate */ \
+    opcode.bit <22>()      /* sign */
   for(uint1 save : range(2))
   for(uint1 accumulate : range(2))
   for(uint1 sign : range(2)) {
@@ -345,7 +350,7 @@ auto ARM7TDMI::armInitialize() -> void {
   #undef arguments
 
   #define arguments \
-    opcode.bits( 0,23)  /* immediate */
+    opcode.bits< 0,23>()  /* immediate */
   for(uint4 immediateLo : range(16))
   for(uint4 immediateHi : range(16)) {
     auto opcode = pattern(".... 1111 ???? ???? ???? ???? ???? ????") | immediateLo << 4 | immediateHi << 20;
@@ -356,7 +361,7 @@ auto ARM7TDMI::armInitialize() -> void {
   #define arguments
   for(uint12 id : range(4096)) {
     if(armInstruction[id]) continue;
-    auto opcode = pattern(".... ???? ???? ---- ---- ---- ???? ----") | id.bits(0,3) << 4 | id.bits(4,11) << 20;
+    auto opcode = pattern(".... ???? ???? ---- ---- ---- ???? ----") | id.bits<0,3>() << 4 | id.bits<4,11>() << 20;
     bind(opcode, Undefined);
   }
   #undef arguments
@@ -386,7 +391,7 @@ auto ARM7TDMI::thumbInitialize() -> void {
   for(uint4 m : range(16))
   for(uint2 mode : range(4)) {
     if(mode == 3) continue;
-    auto opcode = pattern("0100 01?? ???? ????") | d.bits(0,2) << 0 | m << 3 | d.bit(3) << 7 | mode << 8;
+    auto opcode = pattern("0100 01?? ???? ????") | d.bits<0,2>() << 0 | m << 3 | d.bit<3>() << 7 | mode << 8;
     bind(opcode, ALUExtended, d, m, mode);
   }
 
@@ -20,7 +20,7 @@ auto ARM7TDMI::armALU(uint4 mode, uint4 d, uint4 n, uint32 rm) -> void {
   case 15: r(d) = BIT(~rm); break;  //MVN
   }
 
-  if(exception() && d == 15 && opcode.bit(20)) {
+  if(exception() && d == 15 && opcode.bit<20>()) {
     cpsr() = spsr();
   }
 }
@@ -29,21 +29,21 @@ auto ARM7TDMI::armMoveToStatus(uint4 field, uint1 mode, uint32 data) -> void {
   if(mode && (cpsr().m == PSR::USR || cpsr().m == PSR::SYS)) return;
   PSR& psr = mode ? spsr() : cpsr();
 
-  if(field.bit(0)) {
+  if(field.bit<0>()) {
     if(mode || privileged()) {
-      psr.m = data.bits(0,4);
-      psr.t = data.bit (5);
-      psr.f = data.bit (6);
-      psr.i = data.bit (7);
+      psr.m = data.bits<0,4>();
+      psr.t = data.bit <5>();
+      psr.f = data.bit <6>();
+      psr.i = data.bit <7>();
       if(!mode && psr.t) r(15).data += 2;
     }
   }
 
-  if(field.bit(3)) {
-    psr.v = data.bit(28);
-    psr.c = data.bit(29);
-    psr.z = data.bit(30);
-    psr.n = data.bit(31);
+  if(field.bit<3>()) {
+    psr.v = data.bit<28>();
+    psr.c = data.bit<29>();
+    psr.z = data.bit<30>();
+    psr.n = data.bit<31>();
   }
 }
 
@@ -53,12 +53,13 @@ auto ARM7TDMI::armInstructionBranch
 (int24 displacement, uint1 link) -> void {
   if(link) r(14) = r(15) - 4;
   r(15) = r(15) + displacement * 4;
+  if(link && profiler) profiler.call(r(15), r(14));
 }
 
 auto ARM7TDMI::armInstructionBranchExchangeRegister
 (uint4 m) -> void {
   uint32 address = r(m);
-  cpsr().t = address.bit(0);
+  cpsr().t = address.bit<0>();
   r(15) = address;
 }
 
@@ -193,7 +194,7 @@ auto ARM7TDMI::armInstructionMoveMultiple
 
   auto cpsrMode = cpsr().m;
   bool usr = false;
-  if(type && mode == 1 && !list.bit(15)) usr = true;
+  if(type && mode == 1 && !list.bit<15>()) usr = true;
   if(type && mode == 0) usr = true;
   if(usr) cpsr().m = PSR::USR;
 
@@ -210,7 +211,7 @@ auto ARM7TDMI::armInstructionMoveMultiple
 
   if(mode) {
     idle();
-    if(type && list.bit(15) && cpsr().m != PSR::USR && cpsr().m != PSR::SYS) {
+    if(type && list.bit<15>() && cpsr().m != PSR::USR && cpsr().m != PSR::SYS) {
       cpsr() = spsr();
     }
   } else {
@@ -299,7 +300,7 @@ auto ARM7TDMI::armInstructionMultiplyLong
 
   if(save) {
     cpsr().z = rd == 0;
-    cpsr().n = rd.bit(63);
+    cpsr().n = rd.bit<63>();
   }
 }
 
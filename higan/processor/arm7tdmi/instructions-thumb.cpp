@@ -64,7 +64,7 @@ auto ARM7TDMI::thumbInstructionAdjustStack
 auto ARM7TDMI::thumbInstructionBranchExchange
 (uint4 m) -> void {
   uint32 address = r(m);
-  cpsr().t = address.bit(0);
+  cpsr().t = address.bit<0>();
   r(15) = address;
 }
 
@@ -77,6 +77,7 @@ auto ARM7TDMI::thumbInstructionBranchFarSuffix
 (uint11 displacement) -> void {
   r(15) = r(14) + (displacement * 2);
   r(14) = pipeline.decode.address | 1;
+  if(profiler) profiler.call(r(15), pipeline.decode.address);
 }
 
 auto ARM7TDMI::thumbInstructionBranchNear
@@ -266,3 +266,24 @@ auto GSU::disassembleALT3(char* output) -> void {
 #undef op0
 #undef op1
 #undef op2
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto GSU::histogramReport() -> string {
+  //the disassembler decodes the pipeline register in the current ALT mode, so substitute each sample
+  uint8 pipeline = regs.pipeline;
+  uint alt = regs.sfr.alt;
+  uint16 r15 = regs.r[15].data;
+  auto output = histogram.report([&](uint key, uint32_t address) -> string {
+    regs.pipeline = key;
+    regs.sfr.alt = key >> 8;
+    regs.r[15].data = address + 1;
+    char text[256];
+    disassembleOpcode(text);
+    return string{hex(address, 6L), "  ", text}.stripRight();
+  });
+  regs.pipeline = pipeline;
+  regs.sfr.alt = alt;
+  regs.r[15].data = r15;
+  return output;
+}
+#endif
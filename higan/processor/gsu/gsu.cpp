@@ -13,6 +13,10 @@ namespace Processor {
 #include "disassembler.cpp"
 
 auto GSU::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 10);
+  #endif
+
   for(auto& r : regs.r) {
     r.data = 0x0000;
     r.modified = false;
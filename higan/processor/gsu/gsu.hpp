@@ -1,5 +1,8 @@
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct GSU {
@@ -80,6 +83,13 @@ struct GSU {
   auto disassembleALT1(char* output) -> void;
   auto disassembleALT2(char* output) -> void;
   auto disassembleALT3(char* output) -> void;
+
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = ALT mode << 8 | opcode
+  #endif
+
+  Emulator::Profiler profiler;
 };
 
 }
@@ -1,4 +1,8 @@
 auto GSU::instruction(uint8 opcode) -> void {
+  if(profiler) profiler.instruction(regs.pbr << 16 | (uint16)(regs.r[15] - 1));
+  HISTOGRAM_SAMPLE(regs.pbr << 16 | (uint16)(regs.r[15] - 1));
+  HISTOGRAM_KEY(regs.sfr.alt << 8 | opcode);
+
   #define op(id, name, ...) \
     case id: return instruction##name(__VA_ARGS__); \
 
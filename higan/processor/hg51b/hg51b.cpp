@@ -9,14 +9,21 @@ namespace Processor {
 
 auto HG51B::exec(uint24 addr) -> void {
   if(regs.halt) return;
+  if(profiler) profiler.instruction(regs.pc);
+  HISTOGRAM_SAMPLE(regs.pc);
   addr = addr + regs.pc * 2;
   opcode  = read(addr++) << 0;
   opcode |= read(addr++) << 8;
+  HISTOGRAM_KEY(opcode >> 8);
   regs.pc = (regs.pc & 0xffff00) | ((regs.pc + 1) & 0x0000ff);
   instruction();
 }
 
 auto HG51B::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 8);
+  #endif
+
   regs.halt = true;
 
   regs.n = 0;
@@ -24,4 +31,13 @@ auto HG51B::power() -> void {
   regs.c = 0;
 }
 
+#if defined(PROCESSOR_HISTOGRAM)
+//there is no disassembler for this processor, so the report lists opcodes by their high byte
+auto HG51B::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    return {hex(address, 6L), "  ", hex(key, 2L), "xx"};
+  });
+}
+#endif
+
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 //Hitachi HG51B169 (HG51BS family/derivative?)
 
 namespace Processor {
@@ -12,6 +15,13 @@ struct HG51B {
   auto power() -> void;
   auto serialize(serializer&) -> void;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode >> 8; the low byte is an operand
+  #endif
+
+  Emulator::Profiler profiler;
+
 //uint16 programROM[2][256];
   uint24 dataROM[1024];
   uint8  dataRAM[3072];
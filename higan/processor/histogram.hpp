@@ -0,0 +1,101 @@
+#pragma once
+
+//optional per-opcode execution and cycle counters, shared by all processor cores
+//building with -DPROCESSOR_HISTOGRAM adds a histogram member to each core;
+//otherwise the macros below expand to nothing and the cores are left untouched
+
+#if defined(PROCESSOR_HISTOGRAM)
+
+#include <emulator/thread.hpp>
+
+namespace Processor {
+
+struct Histogram {
+  struct Entry {
+    uint64_t executions;
+    uint64_t cycles;
+    uint32_t address;  //most recent location this key executed from
+  };
+
+  //charges the owning thread's clock delta across one instruction to the key assigned during it
+  //keys are assigned through the histogram, so prefixed opcodes may refine the key in their own handlers
+  struct Sample {
+    Sample(Histogram& histogram, uint32_t address) : histogram(histogram) {
+      histogram.key = ~0u;  //left unassigned when an interrupt is taken in place of an instruction
+      histogram.address = address;
+      if(histogram.thread) clock = histogram.thread->clock();
+    }
+
+    ~Sample() {
+      histogram.record(histogram.key, histogram.address, clock);
+    }
+
+    Histogram& histogram;
+    uintmax clock = 0;
+  };
+
+  //thread is the Emulator::Thread driving the core; size is the number of distinct keys
+  auto attach(Emulator::Thread* thread, uint size) -> void {
+    this->thread = thread;
+    entries.resize(size);
+    reset();
+  }
+
+  auto reset() -> void {
+    for(auto& entry : entries) entry = {};
+  }
+
+  auto record(uint key, uint32_t address, uintmax clock) -> void {
+    if(key >= entries.size()) return;
+    auto& entry = entries[key];
+    entry.executions++;
+    entry.address = address;
+    //the scheduler rebases every clock when it exits; samples straddling that are not timed
+    if(!thread || !thread->scalar() || thread->clock() < clock) return;
+    entry.cycles += (thread->clock() - clock) / thread->scalar();
+  }
+
+  //one line per executed key, most expensive first:
+  //key, executions, cycles, cycles per execution, and a disassembly of the key's last location
+  //call between frames: some disassemblers read through the bus
+  auto report(const function_ref<string (uint key, uint32_t address)>& disassemble) const -> string {
+    vector<uint> keys;
+    for(uint key : range(entries.size())) {
+      if(entries[key].executions) keys.append(key);
+    }
+    sort(keys.data(), keys.size(), [&](uint x, uint y) {
+      return entries[x].cycles > entries[y].cycles;
+    });
+
+    uint digits = max(2u, (bit::first(bit::round(entries.size())) + 3) / 4);
+    string output;
+    for(uint key : keys) {
+      auto& entry = entries[key];
+      output.append(hex(key, digits), "  ");
+      output.append(pad(entry.executions, 12), "  ");
+      output.append(pad(entry.cycles, 14), "  ");
+      output.append(pad(entry.cycles / entry.executions, 6), "  ");
+      output.append(disassemble ? disassemble(key, entry.address) : string{}, "\n");
+    }
+    return output;
+  }
+
+  Emulator::Thread* thread = nullptr;
+  vector<Entry> entries;
+  uint key = ~0u;
+  uint32_t address = 0;
+};
+
+}
+
+#define HISTOGRAM_SAMPLE(address) Histogram::Sample histogramSample{histogram, (uint32_t)(address)}
+#define HISTOGRAM_KEY(value) histogram.key = (value)
+#define HISTOGRAM_ADDRESS(value) histogram.address = (value)
+
+#else
+
+#define HISTOGRAM_SAMPLE(address)
+#define HISTOGRAM_KEY(value)
+#define HISTOGRAM_ADDRESS(value)
+
+#endif
@@ -1,6 +1,6 @@
 auto HuC6280::disassemble(uint16 pc) -> string {
-  uint8 bank = r.mpr[pc.bits(13,15)];
-  uint13 addr = pc.bits(0,12);
+  uint8 bank = r.mpr[pc.bits<13,15>()];
+  uint13 addr = pc.bits<0,12>();
 
   string s{hex(bank, 2L), ":", hex(addr, 4L), "  "};
 
@@ -354,3 +354,14 @@ U op(0xfc, "nop", "$fc")
 
   return s;
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto HuC6280::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    auto text = disassemble(address);
+    //drop the register state, which describes the processor now rather than the sample
+    if(auto position = text.find(" A:")) text.resize(position());
+    return text.stripRight();
+  });
+}
+#endif
@@ -8,8 +8,8 @@ namespace Processor {
 #define Y r.y
 #define S r.s
 #define PC r.pc
-#define PCH r.pc.byte(1)
-#define PCL r.pc.byte(0)
+#define PCH r.pc.byte<1>()
+#define PCL r.pc.byte<0>()
 #define P r.p
 #define C r.p.c
 #define Z r.p.z
@@ -51,6 +51,10 @@ namespace Processor {
 #undef ALU
 
 auto HuC6280::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 9);
+  #endif
+
   r.a = 0x00;
   r.x = 0x00;
   r.y = 0x00;
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct HuC6280 {
@@ -107,6 +110,13 @@ struct HuC6280 {
   //disassembler.cpp
   auto disassemble(uint16 pc) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode | T << 8
+  #endif
+
+  Emulator::Profiler profiler;
+
   //serialization.cpp
   auto serialize(serializer&) -> void;
 
@@ -125,14 +135,14 @@ struct HuC6280 {
     }
 
     inline auto& operator=(uint8 data) {
-      c = data.bit(0);
-      z = data.bit(1);
-      i = data.bit(2);
-      d = data.bit(3);
-      b = data.bit(4);
-      t = data.bit(5);
-      v = data.bit(6);
-      n = data.bit(7);
+      c = data.bit<0>();
+      z = data.bit<1>();
+      i = data.bit<2>();
+      d = data.bit<3>();
+      b = data.bit<4>();
+      t = data.bit<5>();
+      v = data.bit<6>();
+      n = data.bit<7>();
       return *this;
     }
   };
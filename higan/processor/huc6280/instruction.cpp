@@ -2,6 +2,7 @@
 #define fp(name) &HuC6280::algorithm##name
 
 auto HuC6280::interrupt(uint16 vector) -> void {
+  uint16 returnAddress = PC;
   io();
   io();
   push(PC >> 8);
@@ -9,12 +10,16 @@ auto HuC6280::interrupt(uint16 vector) -> void {
   push(P);
   D = 0;
   I = 1;
-  PC.byte(0) = load16(vector + 0);
-L PC.byte(1) = load16(vector + 1);
+  PC.byte<0>() = load16(vector + 0);
+L PC.byte<1>() = load16(vector + 1);
+  if(profiler) profiler.call(PC, returnAddress);
 }
 
 auto HuC6280::instruction() -> void {
+  if(profiler) profiler.instruction(PC);
+  HISTOGRAM_SAMPLE(PC);
   auto code = opcode();
+  HISTOGRAM_KEY(code | T << 8);
 
   if(T) {
     T = 0;
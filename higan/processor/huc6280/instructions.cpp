@@ -92,6 +92,7 @@ auto HuC6280::instructionBranchSubroutine() -> void {
   io();
   push((PC - 1) >> 8);
 L push((PC - 1) >> 0);
+  if(profiler) profiler.call(uint16(PC + (int8)displacement), PC);
   PC += (int8)displacement;
 }
 
@@ -104,8 +105,8 @@ auto HuC6280::instructionBreak() -> void {
   push(p | 0x10);  //B flag set on push
   D = 0;
   I = 1;
-  PC.byte(0) = load16(0xfff6);
-L PC.byte(1) = load16(0xfff7);
+  PC.byte<0>() = load16(0xfff6);
+L PC.byte<1>() = load16(0xfff7);
 }
 
 auto HuC6280::instructionCallAbsolute() -> void {
@@ -115,6 +116,7 @@ auto HuC6280::instructionCallAbsolute() -> void {
   io();
   push((PC - 1) >> 8);
 L push((PC - 1) >> 0);
+  if(profiler) profiler.call(address, PC);
   PC = address;
 }
 
@@ -193,8 +195,8 @@ auto HuC6280::instructionJumpIndirect(uint8 index) -> void {
   address |= operand() << 8;
   io();
   io();
-  PC.byte(0) = load16(address + index + 0);
-L PC.byte(1) = load16(address + index + 1);
+  PC.byte<0>() = load16(address + index + 0);
+L PC.byte<1>() = load16(address + index + 1);
 }
 
 auto HuC6280::instructionMemory(fp alu) -> void {
@@ -213,7 +215,7 @@ auto HuC6280::instructionPull(uint8& data) -> void {
   io();
 L data = pull();
   Z = data == 0;
-  N = data.bit(7);
+  N = data.bit<7>();
 }
 
 auto HuC6280::instructionPullP() -> void {
@@ -242,16 +244,16 @@ auto HuC6280::instructionReturnInterrupt() -> void {
   io();
   io();
   P = pull();
-  PC.byte(0) = pull();
-L PC.byte(1) = pull();
+  PC.byte<0>() = pull();
+L PC.byte<1>() = pull();
 }
 
 auto HuC6280::instructionReturnSubroutine() -> void {
   io();
   io();
   io();
-  PC.byte(0) = pull();
-  PC.byte(1) = pull();
+  PC.byte<0>() = pull();
+  PC.byte<1>() = pull();
 L io();
   PC++;
 }
@@ -293,8 +295,8 @@ auto HuC6280::instructionTestAbsolute(uint8 index) -> void {
   io();
 L uint8 data = load16(absolute + index);
   Z = (data & mask) == 0;
-  V = data.bit(6);
-  N = data.bit(7);
+  V = data.bit<6>();
+  N = data.bit<7>();
 }
 
 auto HuC6280::instructionTestZeroPage(uint8 index) -> void {
@@ -305,15 +307,15 @@ auto HuC6280::instructionTestZeroPage(uint8 index) -> void {
   io();
 L uint8 data = load8(zeropage + index);
   Z = (data & mask) == 0;
-  V = data.bit(6);
-  N = data.bit(7);
+  V = data.bit<6>();
+  N = data.bit<7>();
 }
 
 auto HuC6280::instructionTransfer(uint8& source, uint8& target) -> void {
 L io();
   target = source;
   Z = target == 0;
-  N = target.bit(7);
+  N = target.bit<7>();
 }
 
 auto HuC6280::instructionTransferAccumulatorToMPR() -> void {
@@ -56,7 +56,7 @@ auto LR35902::OR(uint8 target, uint8 source) -> uint8 {
 }
 
 auto LR35902::RL(uint8 target) -> uint8 {
-  bool carry = target.bit(7);
+  bool carry = target.bit<7>();
   target = target << 1 | CF;
   CF = carry;
   HF = NF = 0;
@@ -66,14 +66,14 @@ auto LR35902::RL(uint8 target) -> uint8 {
 
 auto LR35902::RLC(uint8 target) -> uint8 {
   target = target << 1 | target >> 7;
-  CF = target.bit(0);
+  CF = target.bit<0>();
   HF = NF = 0;
   ZF = target == 0;
   return target;
 }
 
 auto LR35902::RR(uint8 target) -> uint8 {
-  bool carry = target.bit(0);
+  bool carry = target.bit<0>();
   target = CF << 7 | target >> 1;
   CF = carry;
   HF = NF = 0;
@@ -83,14 +83,14 @@ auto LR35902::RR(uint8 target) -> uint8 {
 
 auto LR35902::RRC(uint8 target) -> uint8 {
   target = target << 7 | target >> 1;
-  CF = target.bit(7);
+  CF = target.bit<7>();
   HF = NF = 0;
   ZF = target == 0;
   return target;
 }
 
 auto LR35902::SLA(uint8 target) -> uint8 {
-  bool carry = target.bit(7);
+  bool carry = target.bit<7>();
   target <<= 1;
   CF = carry;
   HF = NF = 0;
@@ -99,7 +99,7 @@ auto LR35902::SLA(uint8 target) -> uint8 {
 }
 
 auto LR35902::SRA(uint8 target) -> uint8 {
-  bool carry = target.bit(0);
+  bool carry = target.bit<0>();
   target = (int8)target >> 1;
   CF = carry;
   HF = NF = 0;
@@ -108,7 +108,7 @@ auto LR35902::SRA(uint8 target) -> uint8 {
 }
 
 auto LR35902::SRL(uint8 target) -> uint8 {
-  bool carry = target.bit(0);
+  bool carry = target.bit<0>();
   target >>= 1;
   CF = carry;
   HF = NF = 0;
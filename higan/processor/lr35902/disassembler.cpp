@@ -531,3 +531,11 @@ auto LR35902::disassembleOpcodeCB(uint16 pc) -> string {
 
   unreachable;
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto LR35902::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    return {hex(address, 4L), "  ", disassembleOpcode(address)};
+  });
+}
+#endif
@@ -4,13 +4,17 @@ auto LR35902::interrupt(uint16 vector) -> void {
   idle();
   r.ime = 0;
   push(PC);
+  if(profiler) profiler.call(vector, PC);
   PC = vector;
 }
 
 #define op(id, name, ...) case id: return instruction##name(__VA_ARGS__);
 
 auto LR35902::instruction() -> void {
+  if(profiler) profiler.instruction(PC);
+  HISTOGRAM_SAMPLE(PC);
   auto opcode = operand();
+  HISTOGRAM_KEY(opcode);
 
   switch(opcode) {
   op(0x00, NOP)
@@ -263,6 +267,7 @@ auto LR35902::instruction() -> void {
 
 auto LR35902::instructionCB() -> void {
   auto opcode = operand();
+  HISTOGRAM_KEY(0x100 | opcode);
 
   switch(opcode) {
   op(0x00, RLC_Direct, B)
@@ -332,8 +337,8 @@ auto LR35902::instructionCB() -> void {
   }
 
   //opcodes 0x40-0xff [op(0x00 - 0x07) declared above]
-  uint3 bit = opcode.bits(3,5);
-  switch(opcode.bits(6,7) << 3 | opcode.bits(0,2)) {
+  uint3 bit = opcode.bits<3,5>();
+  switch(opcode.bits<6,7>() << 3 | opcode.bits<0,2>()) {
   op(0x08, BIT_Index_Direct, bit, B)
   op(0x09, BIT_Index_Direct, bit, C)
   op(0x0a, BIT_Index_Direct, bit, D)
@@ -68,6 +68,7 @@ auto LR35902::instructionCALL_Condition_Address(bool take) -> void {
   if(!take) return;
   idle();
   push(PC);
+  if(profiler) profiler.call(address, PC);
   PC = address;
 }
 
@@ -106,7 +107,7 @@ auto LR35902::instructionDAA() -> void {
     if(CF) a -= 0x60;
   }
   A = a;
-  CF |= a.bit(8);
+  CF |= a.bit<8>();
   HF = 0;
   ZF = A == 0;
 }
@@ -365,6 +366,7 @@ auto LR35902::instructionRRCA() -> void {
 auto LR35902::instructionRST_Implied(uint8 vector) -> void {
   idle();
   push(PC);
+  if(profiler) profiler.call(vector, PC);
   PC = vector;
 }
 
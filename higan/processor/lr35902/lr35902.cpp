@@ -12,6 +12,10 @@ namespace Processor {
 #include "disassembler.cpp"
 
 auto LR35902::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 9);
+  #endif
+
   r = {};
 }
 
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct LR35902 {
@@ -25,6 +28,13 @@ struct LR35902 {
   virtual auto readDebugger(uint16 address) -> uint8 { return 0; }
   auto disassemble(uint16 pc) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode, or 0x100 | opcode for CB-prefixed opcodes
+  #endif
+
+  Emulator::Profiler profiler;
+
   //memory.cpp
   auto operand() -> uint8;
   auto operands() -> uint16;
@@ -294,8 +294,8 @@ template<uint Size> auto M68K::disassembleEXT(DataRegister with) -> string {
 }
 
 auto M68K::disassembleILLEGAL(uint16 code) -> string {
-  if(code.bits(12,15) == 0xa) return {"linea   $", hex(code.bits(0,11), 3L)};
-  if(code.bits(12,15) == 0xf) return {"linef   $", hex(code.bits(0,11), 3L)};
+  if(code.bits<12,15>() == 0xa) return {"linea   $", hex(code.bits<0,11>(), 3L)};
+  if(code.bits<12,15>() == 0xf) return {"linef   $", hex(code.bits<0,11>(), 3L)};
   return {"illegal "};
 }
 
@@ -586,3 +586,11 @@ template<uint Size> auto M68K::disassembleTST(EffectiveAddress ea) -> string {
 auto M68K::disassembleUNLK(AddressRegister with) -> string {
   return {"unlk    ", _addressRegister(with)};
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto M68K::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    return disassemble(address);
+  });
+}
+#endif
@@ -1,9 +1,12 @@
 auto M68K::instruction() -> void {
+  if(profiler) profiler.instruction(r.pc);
+  HISTOGRAM_SAMPLE(r.pc);
   opcode = readPC();
+  HISTOGRAM_KEY(opcode);
   return instructionTable[opcode]();
 }
 
-M68K::M68K() {
+auto M68K::instructionInitialize() -> void {
   #define bind(id, name, ...) { \
     assert(!instructionTable[id]); \
     instructionTable[id] = [=] { return instruction##name(__VA_ARGS__); }; \
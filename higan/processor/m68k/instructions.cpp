@@ -258,7 +258,9 @@ auto M68K::instructionBCC(uint4 condition, uint8 displacement) -> void {
   if(displacement) r.pc -= 2;
   if(condition >= 2 && !testCondition(condition)) return;
   if(condition == 1) push<Long>(r.pc);
+  auto returnAddress = r.pc;
   r.pc += displacement ? (int8_t)displacement : (int16_t)extension - 2;
+  if(condition == 1 && profiler) profiler.call(r.pc, returnAddress);
 }
 
 template<uint Size> auto M68K::instructionBCHG(DataRegister bit, EffectiveAddress with) -> void {
@@ -523,8 +525,8 @@ template<> auto M68K::instructionEXT<Long>(DataRegister with) -> void {
 
 auto M68K::instructionILLEGAL(uint16 code) -> void {
   r.pc -= 2;
-  if(code.bits(12,15) == 0xa) return exception(Exception::Illegal, Vector::IllegalLineA);
-  if(code.bits(12,15) == 0xf) return exception(Exception::Illegal, Vector::IllegalLineF);
+  if(code.bits<12,15>() == 0xa) return exception(Exception::Illegal, Vector::IllegalLineA);
+  if(code.bits<12,15>() == 0xf) return exception(Exception::Illegal, Vector::IllegalLineF);
   return exception(Exception::Illegal, Vector::Illegal);
 }
 
@@ -535,6 +537,7 @@ auto M68K::instructionJMP(EffectiveAddress target) -> void {
 auto M68K::instructionJSR(EffectiveAddress target) -> void {
   auto pc = fetch<Long>(target);
   push<Long>(r.pc);
+  if(profiler) profiler.call(pc, r.pc);
   r.pc = pc;
 }
 
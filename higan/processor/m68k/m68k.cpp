@@ -15,6 +15,13 @@ enum : bool { Reverse = 1 };
 #include "serialization.cpp"
 
 auto M68K::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 16);
+  #endif
+
+  //every opcode is bound once built, so an empty slot means the table has not been built yet
+  if(!instructionTable[0]) instructionInitialize();
+
   for(auto& dr : r.d) dr = 0;
   for(auto& ar : r.a) ar = 0;
   r.sp = 0;
@@ -56,6 +63,7 @@ auto M68K::exception(uint exception, uint vector, uint priority) -> void {
   push<Word>(sr);
 
   r.pc = read<Long>(vector << 2);
+  if(profiler) profiler.call(r.pc, pc);
 }
 
 }
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 //Motorola M68000
 
 namespace Processor {
@@ -56,7 +59,6 @@ struct M68K {
     VerticalBlank   = 30,
   };};
 
-  M68K();
   auto power() -> void;
   auto supervisor() -> bool;
   auto exception(uint exception, uint vector, uint priority = 7) -> void;
@@ -107,6 +109,7 @@ struct M68K {
 
   //instruction.cpp
   auto instruction() -> void;
+  auto instructionInitialize() -> void;
 
   //instructions.cpp
   auto testCondition(uint4 condition) -> bool;
@@ -255,6 +258,13 @@ struct M68K {
   auto disassemble(uint32 pc) -> string;
   auto disassembleRegisters() -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode
+  #endif
+
+  Emulator::Profiler profiler;
+
   struct Registers {
     uint32 d[8];  //data registers
     uint32 a[8];  //address registers (a7 = s ? ssp : usp)
@@ -276,7 +286,7 @@ struct M68K {
 
   uint16 opcode = 0;
 
-  function<void ()> instructionTable[65536];
+  function<void ()> instructionTable[65536];  //built on first power(), keeping static construction cheap
   Bus* bus = nullptr;
 
 private:
@@ -29,20 +29,20 @@ auto M68K::readSR() -> uint16 {
 }
 
 auto M68K::writeCCR(uint8 ccr) -> void {
-  r.c = ccr.bit(0);
-  r.v = ccr.bit(1);
-  r.z = ccr.bit(2);
-  r.n = ccr.bit(3);
-  r.x = ccr.bit(4);
+  r.c = ccr.bit<0>();
+  r.v = ccr.bit<1>();
+  r.z = ccr.bit<2>();
+  r.n = ccr.bit<3>();
+  r.x = ccr.bit<4>();
 }
 
 auto M68K::writeSR(uint16 sr) -> void {
   writeCCR(sr);
 
   //when entering or exiting supervisor mode; swap SSP and USP into A7
-  if(r.s != sr.bit(13)) swap(r.a[7], r.sp);
+  if(r.s != sr.bit<13>()) swap(r.a[7], r.sp);
 
-  r.i = sr.bits(8,10);
-  r.s = sr.bit(13);
-  r.t = sr.bit(15);
+  r.i = sr.bits<8,10>();
+  r.s = sr.bit<13>();
+  r.t = sr.bit<15>();
 }
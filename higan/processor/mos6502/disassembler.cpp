@@ -232,3 +232,14 @@ auto MOS6502::disassemble(uint16 pc) -> string {
 
   return s;
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto MOS6502::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    auto text = disassemble(address);
+    //drop the register state, which describes the processor now rather than the sample
+    if(auto position = text.find(" A:")) text.resize(position());
+    return text.stripRight();
+  });
+}
+#endif
@@ -2,6 +2,7 @@
 #define fp(name) &MOS6502::algorithm##name
 
 auto MOS6502::interrupt() -> void {
+  uint16 returnAddress = PC;
   idle();
   idle();
   push(PCH);
@@ -12,10 +13,14 @@ auto MOS6502::interrupt() -> void {
   I = 1;
   PCL = read(vector++);
 L PCH = read(vector++);
+  if(profiler) profiler.call(PC, returnAddress);
 }
 
 auto MOS6502::instruction() -> void {
+  if(profiler) profiler.instruction(PC);
+  HISTOGRAM_SAMPLE(PC);
   auto code = opcode();
+  HISTOGRAM_KEY(code);
 
   switch(code) {
   op(0x00, Break)
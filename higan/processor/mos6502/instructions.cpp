@@ -71,6 +71,7 @@ auto MOS6502::instructionCallAbsolute() -> void {
   PC--;
   push(PCH);
 L push(PCL);
+  if(profiler) profiler.call(absolute, uint16(PC + 1));
   PC = absolute;
 }
 
@@ -130,7 +131,7 @@ auto MOS6502::instructionJumpIndirect() -> void {
   uint16 absolute = operand();
   absolute |= operand() << 8;
   uint16 pc = read(absolute);
-  absolute.byte(0)++;  //MOS6502: $00ff wraps here to $0000; not $0100
+  absolute.byte<0>()++;  //MOS6502: $00ff wraps here to $0000; not $0100
 L pc |= read(absolute) << 8;
   PC = pc;
 }
@@ -144,7 +145,7 @@ auto MOS6502::instructionPull(uint8& data) -> void {
   idle();
 L data = pull();
   Z = data == 0;
-  N = data.bit(7);
+  N = data.bit<7>();
 }
 
 auto MOS6502::instructionPullP() -> void {
@@ -190,7 +191,7 @@ L idle();
   target = source;
   if(!flag) return;
   Z = target == 0;
-  N = target.bit(7);
+  N = target.bit<7>();
 }
 
 auto MOS6502::instructionZeroPageModify(fp alu) -> void {
@@ -9,8 +9,8 @@ namespace Processor {
 #define S r.s
 #define P r.p
 #define PC r.pc
-#define PCH r.pc.byte(1)
-#define PCL r.pc.byte(0)
+#define PCH r.pc.byte<1>()
+#define PCL r.pc.byte<0>()
 #define ALU (this->*alu)
 #define C r.p.c
 #define Z r.p.z
@@ -49,6 +49,10 @@ auto MOS6502::mdr() const -> uint8 {
 }
 
 auto MOS6502::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 8);
+  #endif
+
   r.a = 0x00;
   r.x = 0x00;
   r.y = 0x00;
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct MOS6502 {
@@ -90,6 +93,13 @@ struct MOS6502 {
   //disassembler.cpp
   auto disassemble(uint16 pc) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode
+  #endif
+
+  Emulator::Profiler profiler;
+
   //set to false to disable BCD mode in ADC, SBC instructions
   bool BCD = true;
 
@@ -106,12 +116,12 @@ struct MOS6502 {
     }
 
     inline auto& operator=(uint8 data) {
-      c = data.bit(0);
-      z = data.bit(1);
-      i = data.bit(2);
-      d = data.bit(3);
-      v = data.bit(6);
-      n = data.bit(7);
+      c = data.bit<0>();
+      z = data.bit<1>();
+      i = data.bit<2>();
+      d = data.bit<3>();
+      v = data.bit<6>();
+      n = data.bit<7>();
       return *this;
     }
   };
@@ -303,3 +303,14 @@ auto SPC700::disassemble(uint16 addr, bool p) -> string {
 
   return output;
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto SPC700::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    auto text = disassemble(address, PF);
+    //drop the register state, which describes the processor now rather than the sample
+    if(auto position = text.find("YA:")) text.resize(position());
+    return text.stripRight();
+  });
+}
+#endif
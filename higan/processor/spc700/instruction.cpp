@@ -2,7 +2,12 @@
 #define fp(name) &SPC700::algorithm##name
 
 auto SPC700::instruction() -> void {
-  switch(fetch()) {
+  if(profiler) profiler.instruction(PC);
+  HISTOGRAM_SAMPLE(PC);
+  uint8 opcode = fetch();
+  HISTOGRAM_KEY(opcode);
+
+  switch(opcode) {
   op(0x00, NoOperation)
   op(0x01, CallTable, 0)
   op(0x02, AbsoluteBitSet, 0, true)
@@ -153,6 +153,7 @@ auto SPC700::instructionBreak() -> void {
   idle();
   uint16 address = read(0xffde + 0);
   address |= read(0xffde + 1) << 8;
+  if(profiler) profiler.call(address, PC);
   PC = address;
   IF = 0;
   BF = 1;
@@ -166,6 +167,7 @@ auto SPC700::instructionCallAbsolute() -> void {
   push(PC >> 0);
   idle();
   idle();
+  if(profiler) profiler.call(address, PC);
   PC = address;
 }
 
@@ -175,6 +177,7 @@ auto SPC700::instructionCallPage() -> void {
   push(PC >> 8);
   push(PC >> 0);
   idle();
+  if(profiler) profiler.call(0xff00 | address, PC);
   PC = 0xff00 | address;
 }
 
@@ -187,6 +190,7 @@ auto SPC700::instructionCallTable(uint4 vector) -> void {
   uint16 address = 0xffde - (vector << 1);
   uint16 pc = read(address + 0);
   pc |= read(address + 1) << 8;
+  if(profiler) profiler.call(pc, PC);
   PC = pc;
 }
 
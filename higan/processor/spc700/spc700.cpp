@@ -30,6 +30,10 @@ namespace Processor {
 #include "disassembler.cpp"
 
 auto SPC700::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 8);
+  #endif
+
   PC = 0x0000;
   YA = 0x0000;
   X = 0x00;
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct SPC700 {
@@ -119,6 +122,13 @@ struct SPC700 {
   //disassembler.cpp
   auto disassemble(uint16 address, bool p) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode
+  #endif
+
+  Emulator::Profiler profiler;
+
   struct Flags {
     bool c;  //carry
     bool z;  //zero
@@ -134,14 +144,14 @@ struct SPC700 {
     }
 
     inline auto& operator=(uint8 data) {
-      c = data.bit(0);
-      z = data.bit(1);
-      i = data.bit(2);
-      h = data.bit(3);
-      b = data.bit(4);
-      p = data.bit(5);
-      v = data.bit(6);
-      n = data.bit(7);
+      c = data.bit<0>();
+      z = data.bit<1>();
+      i = data.bit<2>();
+      h = data.bit<3>();
+      b = data.bit<4>();
+      p = data.bit<5>();
+      v = data.bit<6>();
+      n = data.bit<7>();
       return *this;
     }
   };
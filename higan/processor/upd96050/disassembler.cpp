@@ -190,3 +190,11 @@ auto uPD96050::disassemble(uint14 ip) -> string {
 
   return output;
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto uPD96050::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    return disassemble(address);
+  });
+}
+#endif
@@ -1,5 +1,8 @@
 auto uPD96050::exec() -> void {
+  if(profiler) profiler.instruction(regs.pc);
+  HISTOGRAM_SAMPLE(regs.pc);
   uint24 opcode = programROM[regs.pc++];
+  HISTOGRAM_KEY(opcode >> 16);
   switch(opcode >> 22) {
   case 0: execOP(opcode); break;
   case 1: execRT(opcode); break;
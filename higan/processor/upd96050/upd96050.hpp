@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct uPD96050 {
@@ -26,6 +29,13 @@ struct uPD96050 {
 
   auto disassemble(uint14 ip) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode >> 16: type and ALU or jump selection
+  #endif
+
+  Emulator::Profiler profiler;
+
   enum class Revision : uint { uPD7725, uPD96050 } revision;
   uint24 programROM[16384];
   uint16 dataROM[2048];
@@ -37,12 +47,12 @@ struct uPD96050 {
     }
 
     inline auto operator=(uint16 data) -> Flag& {
-      ov0 = data.bit(0);
-      ov1 = data.bit(1);
-      z   = data.bit(2);
-      c   = data.bit(3);
-      s0  = data.bit(4);
-      s1  = data.bit(5);
+      ov0 = data.bit<0>();
+      ov1 = data.bit<1>();
+      z   = data.bit<2>();
+      c   = data.bit<3>();
+      s0  = data.bit<4>();
+      s1  = data.bit<5>();
       return *this;
     }
 
@@ -64,17 +74,17 @@ struct uPD96050 {
     }
 
     inline auto operator=(uint16 data) -> Status& {
-      p0   = data.bit( 0);
-      p1   = data.bit( 1);
-      ei   = data.bit( 7);
-      sic  = data.bit( 8);
-      soc  = data.bit( 9);
-      drc  = data.bit(10);
-      dma  = data.bit(11);
-      drs  = data.bit(12);
-      usf0 = data.bit(13);
-      usf1 = data.bit(14);
-      rqm  = data.bit(15);
+      p0   = data.bit< 0>();
+      p1   = data.bit< 1>();
+      ei   = data.bit< 7>();
+      sic  = data.bit< 8>();
+      soc  = data.bit< 9>();
+      drc  = data.bit<10>();
+      dma  = data.bit<11>();
+      drs  = data.bit<12>();
+      usf0 = data.bit<13>();
+      usf1 = data.bit<14>();
+      rqm  = data.bit<15>();
       return *this;
     }
 
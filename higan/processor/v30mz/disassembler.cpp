@@ -385,3 +385,11 @@ auto V30MZ::disassemble(uint16 cs, uint16 ip, bool registers, bool bytes) -> str
 
   return {hex(ea, 5L), "  ", s, l, b};
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto V30MZ::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    return disassemble(address >> 16, address, false, false);
+  });
+}
+#endif
@@ -19,6 +19,7 @@ auto V30MZ::interrupt(uint8 vector) -> void {
   push(r.f);
   push(r.cs);
   push(r.ip);
+  if(profiler) profiler.call(cs << 16 | ip, r.cs << 16 | r.ip);
 
   r.f.m = true;
   r.f.i = false;
@@ -31,7 +32,12 @@ auto V30MZ::interrupt(uint8 vector) -> void {
 #define op(id, name, ...) case id: return instruction##name(__VA_ARGS__);
 
 auto V30MZ::instruction() -> void {
-  switch(opcode = fetch()) {
+  if(profiler) profiler.instruction(r.cs << 16 | r.ip);
+  HISTOGRAM_SAMPLE(r.cs << 16 | r.ip);
+  opcode = fetch();
+  HISTOGRAM_KEY(opcode);
+
+  switch(opcode) {
   op(0x00, AddMemReg, Byte)
   op(0x01, AddMemReg, Word)
   op(0x02, AddRegMem, Byte)
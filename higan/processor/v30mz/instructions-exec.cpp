@@ -44,6 +44,7 @@ auto V30MZ::instructionCallNear() -> void {
   wait(4);
   auto offset = (int16)fetch(Word);
   push(r.ip);
+  if(profiler) profiler.call(r.cs << 16 | uint16(r.ip + offset), r.cs << 16 | r.ip);
   r.ip += offset;
 }
 
@@ -53,6 +54,7 @@ auto V30MZ::instructionCallFar() -> void {
   auto cs = fetch(Word);
   push(r.cs);
   push(r.ip);
+  if(profiler) profiler.call(cs << 16 | ip, r.cs << 16 | r.ip);
   r.cs = cs;
   r.ip = ip;
 }
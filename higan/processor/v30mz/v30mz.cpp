@@ -24,6 +24,10 @@ auto V30MZ::warning(string text) -> void {
 }
 
 auto V30MZ::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 8);
+  #endif
+
   state.halt = false;
   state.poll = true;
   state.prefix = false;
@@ -2,6 +2,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct V30MZ {
@@ -211,6 +214,13 @@ struct V30MZ {
   //disassembler.cpp
   auto disassemble(uint16 cs, uint16 ip, bool registers = true, bool bytes = true) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode; prefixes are counted as opcodes of their own
+  #endif
+
+  Emulator::Profiler profiler;  //addresses are cs << 16 | ip
+
   struct State {
     bool halt;    //set to true for hlt instruction; blocks execution until next interrupt
     bool poll;    //set to false to suppress interrupt polling between CPU instructions
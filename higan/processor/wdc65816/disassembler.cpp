@@ -33,16 +33,16 @@ auto WDC65816::dreadb(uint24 addr) -> uint8 {
 
 auto WDC65816::dreadw(uint24 addr) -> uint16 {
   uint16 data;
-  data.byte(0) = dreadb(addr++);
-  data.byte(1) = dreadb(addr++);
+  data.byte<0>() = dreadb(addr++);
+  data.byte<1>() = dreadb(addr++);
   return data;
 }
 
 auto WDC65816::dreadl(uint24 addr) -> uint24 {
   uint24 data;
-  data.byte(0) = dreadb(addr++);
-  data.byte(1) = dreadb(addr++);
-  data.byte(2) = dreadb(addr++);
+  data.byte<0>() = dreadb(addr++);
+  data.byte<1>() = dreadb(addr++);
+  data.byte<2>() = dreadb(addr++);
   return data;
 }
 
@@ -136,9 +136,9 @@ auto WDC65816::disassemble(uint24 addr, bool e, bool m, bool x) -> string {
   uint24 pc = addr;
   s = {hex(pc, 6), " "};
 
-  uint8 op  = dreadb(pc); pc.bits(0,15)++;
-  uint8 op0 = dreadb(pc); pc.bits(0,15)++;
-  uint8 op1 = dreadb(pc); pc.bits(0,15)++;
+  uint8 op  = dreadb(pc); pc.bits<0,15>()++;
+  uint8 op0 = dreadb(pc); pc.bits<0,15>()++;
+  uint8 op1 = dreadb(pc); pc.bits<0,15>()++;
   uint8 op2 = dreadb(pc);
 
   #define op8  ((op0))
@@ -448,3 +448,14 @@ auto WDC65816::disassemble(uint24 addr, bool e, bool m, bool x) -> string {
 
   return s;
 }
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto WDC65816::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    auto text = disassemble(address, false, key >> 8 & 1, key >> 9 & 1);
+    //drop the register state, which describes the processor now rather than the sample
+    if(auto position = text.find(" A:")) text.resize(position());
+    return text;
+  });
+}
+#endif
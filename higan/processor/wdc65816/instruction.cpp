@@ -1,4 +1,5 @@
 auto WDC65816::interrupt() -> void {
+  uint24 returnAddress = PC;
   read(PC);
   idle();
 N push(db(PC));
@@ -10,6 +11,7 @@ N push(db(PC));
   lo(PC) = read(r.vector + 0);
   hi(PC) = read(r.vector + 1);
   db(PC) = 0x00;
+  if(profiler) profiler.call(PC, returnAddress);
 }
 
 //both the accumulator and index registers can independently be in either 8-bit or 16-bit mode.
@@ -21,6 +23,11 @@ auto WDC65816::instruction() -> void {
   //m = instructions affected by M flag (1 = 8-bit; 0 = 16-bit)
   //x = instructions affected by X flag (1 = 8-bit; 0 = 16-bit)
 
+  if(profiler) profiler.instruction(PC);
+  HISTOGRAM_SAMPLE(PC);
+  uint8 opcode = fetch();
+  HISTOGRAM_KEY(opcode | MF << 8 | XF << 9);
+
   #define opA(id, name, ...) case id: return instruction##name(__VA_ARGS__);
   if(MF) {
     #define opM(id, name, ...) case id: return instruction##name##8(__VA_ARGS__);
@@ -1,4 +1,4 @@
-  switch(fetch()) {
+  switch(opcode) {
   opA(0x00, Interrupt, EF ? 0xfffe : 0xffe6)  //emulation mode lacks BRK vector; uses IRQ vector instead
   opM(0x01, IndexedIndirectRead, m(ORA))
   opA(0x02, Interrupt, EF ? 0xfff4 : 0xffe4)
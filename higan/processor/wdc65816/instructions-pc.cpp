@@ -63,6 +63,7 @@ auto WDC65816::instructionCallShort() -> void {
   aa(PC)--;
   push(hi(PC));
 L push(lo(PC));
+  if(profiler) profiler.call(PC & 0xff0000 | data, PC & 0xff0000 | uint16(PC + 1));
   aa(PC) = data;
 }
 
@@ -75,6 +76,7 @@ auto WDC65816::instructionCallLong() -> void {
   aa(PC)--;
   pushN(hi(PC));
 L pushN(lo(PC));
+  if(profiler) profiler.call(data, PC & 0xff0000 | uint16(PC + 1));
   PC = data;
 E hi(S) = 0x01;
 }
@@ -87,6 +89,7 @@ auto WDC65816::instructionCallIndexedIndirect() -> void {
   idle();
   uint16 data = read(db(PC) << 16 | uint16(absolute + X + 0));
 L hi(data) = read(db(PC) << 16 | uint16(absolute + X + 1));
+  if(profiler) profiler.call(PC & 0xff0000 | data, PC);
   aa(PC) = data;
 E hi(S) = 0x01;
 }
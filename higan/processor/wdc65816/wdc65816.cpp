@@ -27,10 +27,10 @@ namespace Processor {
 #define N if(!r.e)
 #define L lastCycle();
 
-#define lo(n) n.byte(0)
-#define hi(n) n.byte(1)
-#define db(n) n.byte(2)
-#define aa(n) n.bits(0,15)
+#define lo(n) n.byte<0>()
+#define hi(n) n.byte<1>()
+#define db(n) n.byte<2>()
+#define aa(n) n.bits<0,15>()
 #define alu(...) (this->*op)(__VA_ARGS__)
 
 #include "memory.cpp"
@@ -44,6 +44,10 @@ namespace Processor {
 #include "instruction.cpp"
 
 auto WDC65816::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 1 << 10);
+  #endif
+
   PC = 0x000000;
   A  = 0x0000;
   X  = 0x0000;
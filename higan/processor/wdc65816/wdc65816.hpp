@@ -4,6 +4,9 @@
 
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 namespace Processor {
 
 struct WDC65816 {
@@ -208,6 +211,13 @@ struct WDC65816 {
   auto dreadl(uint24 addr) -> uint24;
   auto decode(uint8 mode, uint24 addr) -> uint24;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = opcode | M << 8 | X << 9
+  #endif
+
+  Emulator::Profiler profiler;
+
   struct Flags {
     bool c;  //carry
     bool z;  //zero
@@ -223,14 +233,14 @@ struct WDC65816 {
     }
 
     inline auto& operator=(uint8 data) {
-      c = data.bit(0);
-      z = data.bit(1);
-      i = data.bit(2);
-      d = data.bit(3);
-      x = data.bit(4);
-      m = data.bit(5);
-      v = data.bit(6);
-      n = data.bit(7);
+      c = data.bit<0>();
+      z = data.bit<1>();
+      i = data.bit<2>();
+      d = data.bit<3>();
+      x = data.bit<4>();
+      m = data.bit<5>();
+      v = data.bit<6>();
+      n = data.bit<7>();
       return *this;
     }
   };
@@ -1077,3 +1077,14 @@ auto Z80::disassembleED(uint16 pc, uint8 prefix, uint8 code) -> string {
 #undef IDE
 #undef IHL
 #undef ISP
+
+#if defined(PROCESSOR_HISTOGRAM)
+auto Z80::histogramReport() -> string {
+  return histogram.report([&](uint key, uint32_t address) -> string {
+    auto text = disassemble(address);
+    //drop the register state, which describes the processor now rather than the sample
+    if(auto position = text.find(" AF:")) text.resize(position());
+    return text.stripRight();
+  });
+}
+#endif
@@ -1,7 +1,9 @@
 auto Z80::instruction() -> void {
+  if(profiler) profiler.instruction(PC);
+  HISTOGRAM_SAMPLE(PC);
   uint8 code;
   while(true) {
-    R.bits(0,6)++;
+    R.bits<0,6>()++;
     code = opcode();
     if(code == 0xdd) { prefix = Prefix::ix; continue; }
     if(code == 0xfd) { prefix = Prefix::iy; continue; }
@@ -20,10 +22,10 @@ auto Z80::instruction() -> void {
   //R is not incremented here
     instructionCBd(addr, opcode());
   } else if(code == 0xcb) {
-    R.bits(0,6)++;
+    R.bits<0,6>()++;
     instructionCB(opcode());
   } else if(code == 0xed) {
-    R.bits(0,6)++;
+    R.bits<0,6>()++;
     instructionED(opcode());
   } else {
     instruction(code);
@@ -35,6 +37,8 @@ auto Z80::instruction() -> void {
 #define op(id, name, ...) case id: return instruction##name(__VA_ARGS__);
 
 auto Z80::instruction(uint8 code) -> void {
+  HISTOGRAM_KEY((uint)prefix << 10 | 0 << 8 | code);
+
   switch(code) {
   op(0x00, NOP)
   op(0x01, LD_rr_nn, BC)
@@ -296,6 +300,8 @@ auto Z80::instruction(uint8 code) -> void {
 }
 
 auto Z80::instructionCB(uint8 code) -> void {
+  HISTOGRAM_KEY((uint)prefix << 10 | 1 << 8 | code);
+
   switch(code) {
   op(0x00, RLC_r, B)
   op(0x01, RLC_r, C)
@@ -557,6 +563,7 @@ auto Z80::instructionCB(uint8 code) -> void {
 }
 
 auto Z80::instructionCBd(uint16 addr, uint8 code) -> void {
+  HISTOGRAM_KEY((uint)prefix << 10 | 3 << 8 | code);
   uint8 _;
 
   switch(code) {
@@ -820,6 +827,8 @@ auto Z80::instructionCBd(uint16 addr, uint8 code) -> void {
 }
 
 auto Z80::instructionED(uint8 code) -> void {
+  HISTOGRAM_KEY((uint)prefix << 10 | 2 << 8 | code);
+
   switch(code) {
   op(0x40, IN_r_ic, B)
   op(0x41, OUT_ic_r, B)
@@ -82,6 +82,7 @@ auto Z80::instructionCALL_c_nn(bool c) -> void {
   if(!c) return;
   wait(1);
   push(PC);
+  if(profiler) profiler.call(addr, PC);
   PC = addr;
 }
 
@@ -89,6 +90,7 @@ auto Z80::instructionCALL_nn() -> void {
   auto addr = operands();
   wait(1);
   push(PC);
+  if(profiler) profiler.call(addr, PC);
   PC = addr;
 }
 
@@ -146,22 +148,22 @@ auto Z80::instructionCPL() -> void {
   A = ~A;
 
   NF = 1;
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 1;
-  YF = A.bit(5);
+  YF = A.bit<5>();
 }
 
 auto Z80::instructionDAA() -> void {
   auto a = A;
-  if(CF || (A.bits(0,7) > 0x99)) { A += NF ? -0x60 : 0x60; CF = 1; }
-  if(HF || (A.bits(0,3) > 0x09)) { A += NF ? -0x06 : 0x06; }
+  if(CF || (A.bits<0,7>() > 0x99)) { A += NF ? -0x60 : 0x60; CF = 1; }
+  if(HF || (A.bits<0,3>() > 0x09)) { A += NF ? -0x06 : 0x06; }
 
   PF = parity(A);
-  XF = A.bit(3);
-  HF = uint8(A ^ a).bit(4);
-  YF = A.bit(5);
+  XF = A.bit<3>();
+  HF = uint8(A ^ a).bit<4>();
+  YF = A.bit<5>();
   ZF = A == 0;
-  SF = A.bit(7);
+  SF = A.bit<7>();
 }
 
 auto Z80::instructionDEC_irr(uint16& x) -> void {
@@ -199,10 +201,10 @@ auto Z80::instructionEI() -> void {
 
 auto Z80::instructionEX_irr_rr(uint16& x, uint16& y) -> void {
   uint16 z;
-  z.byte(0) = read(x + 0);
-  z.byte(1) = read(x + 1);
-  write(x + 0, y.byte(0));
-  write(x + 1, y.byte(1));
+  z.byte<0>() = read(x + 0);
+  z.byte<1>() = read(x + 1);
+  write(x + 0, y.byte<0>());
+  write(x + 1, y.byte<1>());
   y = z;
 }
 
@@ -350,17 +352,17 @@ auto Z80::instructionLD_r_r2(uint8& x, uint8& y) -> void {
   x = y;
   NF = 0;
   PF = IFF2;
-  XF = x.bit(3);
+  XF = x.bit<3>();
   HF = 0;
-  YF = x.bit(5);
+  YF = x.bit<5>();
   ZF = x == 0;
-  SF = x.bit(7);
+  SF = x.bit<7>();
 }
 
 auto Z80::instructionLD_rr_inn(uint16& x) -> void {
   auto addr = operands();
-  x.byte(0) = read(addr + 0);
-  x.byte(1) = read(addr + 1);
+  x.byte<0>() = read(addr + 0);
+  x.byte<1>() = read(addr + 1);
 }
 
 auto Z80::instructionLD_rr_nn(uint16& x) -> void {
@@ -517,14 +519,14 @@ auto Z80::instructionRL_r(uint8& x) -> void {
 }
 
 auto Z80::instructionRLA() -> void {
-  bool c = A.bit(7);
+  bool c = A.bit<7>();
   A = A << 1 | CF;
 
   CF = c;
   NF = 0;
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 0;
-  YF = A.bit(5);
+  YF = A.bit<5>();
 }
 
 auto Z80::instructionRLC_irr(uint16& addr) -> void {
@@ -540,14 +542,14 @@ auto Z80::instructionRLC_r(uint8& x) -> void {
 }
 
 auto Z80::instructionRLCA() -> void {
-  bool c = A.bit(7);
+  bool c = A.bit<7>();
   A = A << 1 | c;
 
   CF = c;
   NF = 0;
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 0;
-  YF = A.bit(5);
+  YF = A.bit<5>();
 }
 
 auto Z80::instructionRLD() -> void {
@@ -559,11 +561,11 @@ auto Z80::instructionRLD() -> void {
 
   NF = 0;
   PF = parity(A);
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 0;
-  YF = A.bit(5);
+  YF = A.bit<5>();
   ZF = A == 0;
-  SF = A.bit(7);
+  SF = A.bit<7>();
 }
 
 auto Z80::instructionRR_irr(uint16& addr) -> void {
@@ -579,14 +581,14 @@ auto Z80::instructionRR_r(uint8& x) -> void {
 }
 
 auto Z80::instructionRRA() -> void {
-  bool c = A.bit(0);
+  bool c = A.bit<0>();
   A = CF << 7 | A >> 1;
 
   CF = c;
   NF = 0;
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 0;
-  YF = A.bit(5);
+  YF = A.bit<5>();
 }
 
 auto Z80::instructionRRC_irr(uint16& addr) -> void {
@@ -602,14 +604,14 @@ auto Z80::instructionRRC_r(uint8& x) -> void {
 }
 
 auto Z80::instructionRRCA() -> void {
-  bool c = A.bit(0);
+  bool c = A.bit<0>();
   A = c << 7 | A >> 1;
 
   CF = c;
   NF = 0;
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 0;
-  YF = A.bit(5);
+  YF = A.bit<5>();
 }
 
 auto Z80::instructionRRD() -> void {
@@ -621,16 +623,17 @@ auto Z80::instructionRRD() -> void {
 
   NF = 0;
   PF = parity(A);
-  XF = A.bit(3);
+  XF = A.bit<3>();
   HF = 0;
-  YF = A.bit(5);
+  YF = A.bit<5>();
   ZF = A == 0;
-  SF = A.bit(7);
+  SF = A.bit<7>();
 }
 
 auto Z80::instructionRST_o(uint3 vector) -> void {
   wait(1);
   push(PC);
+  if(profiler) profiler.call(vector << 3, PC);
   PC = vector << 3;
 }
 
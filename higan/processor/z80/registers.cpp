@@ -40,15 +40,15 @@
 #define I r.ir.byte.hi
 #define R r.ir.byte.lo
 
-#define CF r.af.byte.lo.bit(0)
-#define NF r.af.byte.lo.bit(1)
-#define PF r.af.byte.lo.bit(2)
-#define VF r.af.byte.lo.bit(2)
-#define XF r.af.byte.lo.bit(3)
-#define HF r.af.byte.lo.bit(4)
-#define YF r.af.byte.lo.bit(5)
-#define ZF r.af.byte.lo.bit(6)
-#define SF r.af.byte.lo.bit(7)
+#define CF r.af.byte.lo.bit<0>()
+#define NF r.af.byte.lo.bit<1>()
+#define PF r.af.byte.lo.bit<2>()
+#define VF r.af.byte.lo.bit<2>()
+#define XF r.af.byte.lo.bit<3>()
+#define HF r.af.byte.lo.bit<4>()
+#define YF r.af.byte.lo.bit<5>()
+#define ZF r.af.byte.lo.bit<6>()
+#define SF r.af.byte.lo.bit<7>()
 
 #define EI r.ei
 #define HALT r.halt
@@ -12,14 +12,19 @@ namespace Processor {
 #include "serialization.cpp"
 
 auto Z80::power() -> void {
+  #if defined(PROCESSOR_HISTOGRAM)
+  histogram.attach(dynamic_cast<Emulator::Thread*>(this), 3 << 10);
+  #endif
+
   r = {};
   prefix = Prefix::hl;
 }
 
 auto Z80::irq(bool maskable, uint16 pc, uint8 extbus) -> bool {
   if(maskable && !IFF1) return false;
-  R.bits(0,6)++;
+  R.bits<0,6>()++;
 
+  uint16 returnAddress = PC;
   push(PC);
 
   switch(maskable ? IM : (uint2)1) {
@@ -46,6 +51,7 @@ auto Z80::irq(bool maskable, uint16 pc, uint8 extbus) -> bool {
 
   }
 
+  if(profiler) profiler.call(PC, returnAddress);
   IFF1 = 0;
   if(maskable) IFF2 = 0;
   return true;
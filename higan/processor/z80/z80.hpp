@@ -1,5 +1,8 @@
 #pragma once
 
+#include <emulator/profiler.hpp>
+#include <processor/histogram.hpp>
+
 //Zilog Z80
 
 namespace Processor {
@@ -28,6 +31,8 @@ struct Z80 {
 
   virtual auto step(uint clocks) -> void = 0;
   virtual auto synchronizing() const -> bool = 0;
+  //one clock spent frozen while the bus is released; hosts may sleep until it is taken back
+  virtual auto idle() -> void { step(1); }
 
   //z80.cpp
   auto power() -> void;
@@ -221,6 +226,13 @@ struct Z80 {
   auto disassembleCBd(uint16 pc, uint8 prefix, int8 d, uint8 code) -> string;
   auto disassembleED(uint16 pc, uint8 prefix, uint8 code) -> string;
 
+  #if defined(PROCESSOR_HISTOGRAM)
+  auto histogramReport() -> string;
+  Histogram histogram;  //key = prefix (hl, ix, iy) << 10 | table (base, CB, ED, CBd) << 8 | opcode
+  #endif
+
+  Emulator::Profiler profiler;
+
   struct Registers {
     union Pair {
       Pair() : word(0) {}
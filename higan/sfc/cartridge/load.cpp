@@ -402,6 +402,7 @@ auto Cartridge::loadMemory(MappedRAM& ram, Markup::Node node, bool required, may
     if(auto fp = platform->open(id(), memory->name(), File::Read, required)) {
       fp->read(ram.data(), ram.size());
     }
+    if(memory->type == "ROM") ram.share();
   }
 }
 
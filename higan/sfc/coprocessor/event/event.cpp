@@ -112,7 +112,7 @@ auto Event::write(uint24 addr, uint8 data) -> void {
 
 auto Event::serialize(serializer& s) -> void {
   Thread::serialize(s);
-  s.array(ram.data(), ram.size());
+  ram.serialize(s);
   s.integer(status);
   s.integer(select);
   s.integer(timerActive);
@@ -46,6 +46,10 @@ auto NECDSP::writeRAM(uint24 addr, uint8 data) -> void {
 auto NECDSP::power() -> void {
   uPD96050::power();
   create(NECDSP::Enter, Frequency);
+  #if defined(PROCESSOR_HISTOGRAM)
+  //uPD96050 has no virtual functions, so it cannot locate its own thread
+  histogram.attach(this, 1 << 8);
+  #endif
 }
 
 }
@@ -2,8 +2,8 @@ auto SA1::serialize(serializer& s) -> void {
   WDC65816::serialize(s);
   Thread::serialize(s);
 
-  s.array(iram.data(), iram.size());
-  s.array(bwram.data(), bwram.size());
+  iram.serialize(s);
+  bwram.serialize(s);
 
   //sa1.hpp
   s.integer(status.counter);
@@ -15,7 +15,7 @@ auto SA1::serialize(serializer& s) -> void {
   s.integer(status.hcounter);
 
   //bus/bus.hpp
-  s.array(iram.data(), iram.size());
+  iram.serialize(s);
 
   s.integer(cpubwram.dma);
 
@@ -1,5 +1,5 @@
 auto SDD1::serialize(serializer& s) -> void {
-  s.array(ram.data(), ram.size());
+  ram.serialize(s);
 
   s.integer(r4800);
   s.integer(r4801);
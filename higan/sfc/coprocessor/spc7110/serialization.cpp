@@ -1,5 +1,5 @@
 auto SPC7110::serialize(serializer& s) -> void {
-  s.array(ram.data(), ram.size());
+  ram.serialize(s);
 
   s.integer(r4801);
   s.integer(r4802);
@@ -50,25 +50,17 @@ auto SuperFX::rpix(uint8 x, uint8 y) -> uint8 {
   flushPixelCache(pixelcache[1]);
   flushPixelCache(pixelcache[0]);
 
-  uint cn;  //character number
-  switch(regs.por.obj ? 3 : regs.scmr.ht) {
-  case 0: cn = ((x & 0xf8) << 1) + ((y & 0xf8) >> 3); break;
-  case 1: cn = ((x & 0xf8) << 1) + ((x & 0xf8) >> 1) + ((y & 0xf8) >> 3); break;
-  case 2: cn = ((x & 0xf8) << 1) + ((x & 0xf8) << 0) + ((y & 0xf8) >> 3); break;
-  case 3: cn = ((y & 0x80) << 2) + ((x & 0x80) << 1) + ((y & 0x78) << 1) + ((x & 0x78) >> 3); break;
-  }
+  uint addr = characterAddress(x, y);
   uint bpp = 2 << (regs.scmr.md - (regs.scmr.md >> 1));  // = [regs.scmr.md]{ 2, 4, 4, 8 };
-  uint addr = 0x700000 + (cn * (bpp << 3)) + (regs.scbr << 10) + ((y & 0x07) * 2);
-  uint8 data = 0x00;
-  x = (x & 7) ^ 7;
+  step((regs.clsr ? 5 : 6) * bpp);
 
+  //plane n in byte n; the pixel is then bit x of every byte
+  uint64_t planes = 0;
   for(uint n : range(bpp)) {
     uint byte = ((n >> 1) << 4) + (n & 1);  // = [n]{ 0, 1, 16, 17, 32, 33, 48, 49 };
-    step(regs.clsr ? 5 : 6);
-    data |= ((read(addr + byte) >> x) & 1) << n;
+    planes |= (uint64_t)read(addr + byte) << (n << 3);
   }
-
-  return data;
+  return gatherBits(planes >> ((x & 7) ^ 7));
 }
 
 auto SuperFX::flushPixelCache(PixelCache& cache) -> void {
@@ -76,29 +68,59 @@ auto SuperFX::flushPixelCache(PixelCache& cache) -> void {
 
   uint8 x = cache.offset << 3;
   uint8 y = cache.offset >> 5;
-
-  uint cn;  //character number
-  switch(regs.por.obj ? 3 : regs.scmr.ht) {
-  case 0: cn = ((x & 0xf8) << 1) + ((y & 0xf8) >> 3); break;
-  case 1: cn = ((x & 0xf8) << 1) + ((x & 0xf8) >> 1) + ((y & 0xf8) >> 3); break;
-  case 2: cn = ((x & 0xf8) << 1) + ((x & 0xf8) << 0) + ((y & 0xf8) >> 3); break;
-  case 3: cn = ((y & 0x80) << 2) + ((x & 0x80) << 1) + ((y & 0x78) << 1) + ((x & 0x78) >> 3); break;
-  }
+  uint addr = characterAddress(x, y);
   uint bpp = 2 << (regs.scmr.md - (regs.scmr.md >> 1));  // = [regs.scmr.md]{ 2, 4, 4, 8 };
-  uint addr = 0x700000 + (cn * (bpp << 3)) + (regs.scbr << 10) + ((y & 0x07) * 2);
+
+  //every plane byte is read back first unless all eight pixels are pending.
+  //the clocks are charged up front: a pending RAM buffer write still completes before the first access,
+  //as the buffer never holds more than a single access worth of clocks
+  step((regs.clsr ? 5 : 6) * (cache.bitpend == 0xff ? bpp : bpp * 2));
+
+  //pixel x in byte x; plane n is then bit n of every byte
+  uint64_t pixels = 0;
+  for(uint x : range(8)) pixels |= (uint64_t)cache.data[x] << (x << 3);
 
   for(uint n : range(bpp)) {
     uint byte = ((n >> 1) << 4) + (n & 1);  // = [n]{ 0, 1, 16, 17, 32, 33, 48, 49 };
-    uint8 data = 0x00;
-    for(uint x : range(8)) data |= ((cache.data[x] >> n) & 1) << x;
+    uint8 data = gatherBits(pixels >> n);
     if(cache.bitpend != 0xff) {
-      step(regs.clsr ? 5 : 6);
       data &= cache.bitpend;
       data |= read(addr + byte) & ~cache.bitpend;
     }
-    step(regs.clsr ? 5 : 6);
     write(addr + byte, data);
   }
 
   cache.bitpend = 0x00;
 }
+
+//address of the first plane byte of pixel row y & 7 of the character containing (x, y).
+//character bases depend only on the object mode, screen height, color depth and screen base,
+//so they are tabulated for all 32x32 characters and rebuilt whenever those registers change
+auto SuperFX::characterAddress(uint8 x, uint8 y) -> uint {
+  uint ht = regs.por.obj ? 3 : regs.scmr.ht;
+  uint key = ht | regs.scmr.md << 2 | regs.scbr << 4;
+  if(characters.key != key) {
+    characters.key = key;
+    uint bpp = 2 << (regs.scmr.md - (regs.scmr.md >> 1));
+    for(uint ty : range(32)) {
+      for(uint tx : range(32)) {
+        uint x = tx << 3, y = ty << 3;
+        uint cn;  //character number
+        switch(ht) {
+        case 0: cn = ((x & 0xf8) << 1) + ((y & 0xf8) >> 3); break;
+        case 1: cn = ((x & 0xf8) << 1) + ((x & 0xf8) >> 1) + ((y & 0xf8) >> 3); break;
+        case 2: cn = ((x & 0xf8) << 1) + ((x & 0xf8) << 0) + ((y & 0xf8) >> 3); break;
+        case 3: cn = ((y & 0x80) << 2) + ((x & 0x80) << 1) + ((y & 0x78) << 1) + ((x & 0x78) >> 3); break;
+        }
+        characters.address[ty << 5 | tx] = 0x700000 + (cn * (bpp << 3)) + (regs.scbr << 10);
+      }
+    }
+  }
+  return characters.address[(y >> 3) << 5 | x >> 3] + ((y & 0x07) * 2);
+}
+
+//collects bit 0 of every byte: byte n of the word becomes bit n of the result.
+//each bit lands in the top byte of the product at a distinct position, so no partial products carry into it
+auto SuperFX::gatherBits(uint64_t bytes) -> uint8 {
+  return (bytes & 0x0101010101010101ull) * 0x0102040810204080ull >> 56;
+}
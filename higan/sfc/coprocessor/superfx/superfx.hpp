@@ -28,6 +28,8 @@ struct SuperFX : Processor::GSU, Thread {
   auto rpix(uint8 x, uint8 y) -> uint8 override;
 
   auto flushPixelCache(PixelCache& cache) -> void;
+  auto characterAddress(uint8 x, uint8 y) -> uint;
+  alwaysinline static auto gatherBits(uint64_t bytes) -> uint8;
 
   //memory.cpp
   auto read(uint24 addr, uint8 data = 0x00) -> uint8 override;
@@ -65,6 +67,11 @@ struct SuperFX : Processor::GSU, Thread {
 private:
   uint romMask;
   uint ramMask;
+
+  struct Characters {
+    uint key = ~0;  //object mode, screen height, color depth and screen base the table was built for
+    uint address[32 * 32];
+  } characters;
 };
 
 extern SuperFX superfx;
@@ -82,11 +82,12 @@ auto CPU::power(bool reset) -> void {
   bus.map(reader, writer, "00-3f,80-bf:4300-437f");
 
   reader = [](uint24 addr, uint8) -> uint8 { return cpu.wram[addr]; };
-  writer = [](uint24 addr, uint8 data) -> void { cpu.wram[addr] = data; };
+  writer = [](uint24 addr, uint8 data) -> void { cpu.wram[addr] = data; cpu.wramPages.mark(addr); };
   bus.map(reader, writer, "00-3f,80-bf:0000-1fff", 0x2000);
   bus.map(reader, writer, "7e-7f:0000-ffff", 0x20000);
 
   if(!reset) random.array(wram, sizeof(wram));
+  wramPages.markAll();
 
   //DMA
   for(auto& channel : this->channel) {
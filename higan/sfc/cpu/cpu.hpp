@@ -79,6 +79,7 @@ struct CPU : Processor::WDC65816, Thread, PPUcounter {
   auto serialize(serializer&) -> void;
 
   uint8 wram[128 * 1024];
+  dirtypages wramPages{128 * 1024};
   vector<Thread*> coprocessors;
   vector<Thread*> peripherals;
 
@@ -3,7 +3,7 @@ auto CPU::serialize(serializer& s) -> void {
   Thread::serialize(s);
   PPUcounter::serialize(s);
 
-  s.array(wram);
+  s.pages(wram, sizeof(wram), wramPages);
 
   s.integer(version);
   s.integer(clockCounter);
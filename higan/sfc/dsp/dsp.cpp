@@ -39,159 +39,172 @@ auto DSP::Enter() -> void {
 }
 
 auto DSP::main() -> void {
+  if(settings.fastDSP) return run<true>();
+  return run<false>();
+}
+
+//Fast = sample-granular profile: the voice pipeline runs in the same order, but the SMP
+//is only synchronized once per sample, so register writes land on sample boundaries
+template<bool Fast> auto DSP::run() -> void {
   voice5(voice[0]);
   voice2(voice[1]);
-  tick();
+  tick<Fast>();
 
   voice6(voice[0]);
   voice3(voice[1]);
-  tick();
+  tick<Fast>();
 
   voice7(voice[0]);
   voice4(voice[1]);
   voice1(voice[3]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[0]);
   voice5(voice[1]);
   voice2(voice[2]);
-  tick();
+  tick<Fast>();
 
   voice9(voice[0]);
   voice6(voice[1]);
   voice3(voice[2]);
-  tick();
+  tick<Fast>();
 
   voice7(voice[1]);
   voice4(voice[2]);
   voice1(voice[4]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[1]);
   voice5(voice[2]);
   voice2(voice[3]);
-  tick();
+  tick<Fast>();
 
   voice9(voice[1]);
   voice6(voice[2]);
   voice3(voice[3]);
-  tick();
+  tick<Fast>();
 
   voice7(voice[2]);
   voice4(voice[3]);
   voice1(voice[5]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[2]);
   voice5(voice[3]);
   voice2(voice[4]);
-  tick();
+  tick<Fast>();
 
   voice9(voice[2]);
   voice6(voice[3]);
   voice3(voice[4]);
-  tick();
+  tick<Fast>();
 
   voice7(voice[3]);
   voice4(voice[4]);
   voice1(voice[6]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[3]);
   voice5(voice[4]);
   voice2(voice[5]);
-  tick();
+  tick<Fast>();
 
   voice9(voice[3]);
   voice6(voice[4]);
   voice3(voice[5]);
-  tick();
+  tick<Fast>();
 
   voice7(voice[4]);
   voice4(voice[5]);
   voice1(voice[7]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[4]);
   voice5(voice[5]);
   voice2(voice[6]);
-  tick();
+  tick<Fast>();
 
   voice9(voice[4]);
   voice6(voice[5]);
   voice3(voice[6]);
-  tick();
+  tick<Fast>();
 
   voice1(voice[0]);
   voice7(voice[5]);
   voice4(voice[6]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[5]);
   voice5(voice[6]);
   voice2(voice[7]);
-  tick();
+  tick<Fast>();
 
   voice9(voice[5]);
   voice6(voice[6]);
   voice3(voice[7]);
-  tick();
+  tick<Fast>();
 
   voice1(voice[1]);
   voice7(voice[6]);
   voice4(voice[7]);
-  tick();
+  tick<Fast>();
 
   voice8(voice[6]);
   voice5(voice[7]);
   voice2(voice[0]);
-  tick();
+  tick<Fast>();
 
   voice3a(voice[0]);
   voice9(voice[6]);
   voice6(voice[7]);
-  echo22();
-  tick();
+  if(Fast) echoFilter(); else echo22();
+  tick<Fast>();
 
   voice7(voice[7]);
-  echo23();
-  tick();
+  if(!Fast) echo23();
+  tick<Fast>();
 
   voice8(voice[7]);
-  echo24();
-  tick();
+  if(!Fast) echo24();
+  tick<Fast>();
 
   voice3b(voice[0]);
   voice9(voice[7]);
-  echo25();
-  tick();
+  if(!Fast) echo25();
+  tick<Fast>();
 
   echo26();
-  tick();
+  tick<Fast>();
 
   misc27();
   echo27();
-  tick();
+  tick<Fast>();
 
   misc28();
   echo28();
-  tick();
+  tick<Fast>();
 
   misc29();
   echo29();
-  tick();
+  tick<Fast>();
 
   misc30();
   voice3c(voice[0]);
   echo30();
-  tick();
+  tick<Fast>();
 
   voice4(voice[0]);
   voice1(voice[2]);
-  tick();
+  tick<Fast>();
+
+  if(Fast) {
+    step(32 * 3 * 8);
+    synchronize(smp);
+  }
 }
 
-auto DSP::tick() -> void {
+template<bool Fast> auto DSP::tick() -> void {
+  if(Fast) return;
   step(3 * 8);
   synchronize(smp);
 }
@@ -233,6 +246,7 @@ auto DSP::power(bool reset) -> void {
   stream = Emulator::audio.createStream(2, frequency() / 768.0);
 
   if(!reset) random.array(apuram, sizeof(apuram));
+  apuramPages.markAll();
 
   memory::fill(&state, sizeof(State));
   state.noise = 0x4000;
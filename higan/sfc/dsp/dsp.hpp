@@ -3,6 +3,7 @@
 struct DSP : Thread {
   shared_pointer<Emulator::Stream> stream;
   uint8 apuram[64 * 1024];
+  dirtypages apuramPages{64 * 1024};
 
   DSP();
 
@@ -158,6 +159,7 @@ private:
   auto echoOutput(bool channel) -> int;
   auto echoRead(bool channel) -> void;
   auto echoWrite(bool channel) -> void;
+  auto echoFilter() -> void;
   auto echo22() -> void;
   auto echo23() -> void;
   auto echo24() -> void;
@@ -170,7 +172,8 @@ private:
 
   //dsp.cpp
   static auto Enter() -> void;
-  auto tick() -> void;
+  template<bool Fast> auto run() -> void;
+  template<bool Fast> auto tick() -> void;
 };
 
 extern DSP dsp;
@@ -23,11 +23,39 @@ auto DSP::echoWrite(bool channel) -> void {
     int s = state._echoOut[channel];
     apuram[(uint16)(addr + 0)] = s;
     apuram[(uint16)(addr + 1)] = s >> 8;
+    apuramPages.mark((uint16)(addr + 0));
+    apuramPages.mark((uint16)(addr + 1));
   }
 
   state._echoOut[channel] = 0;
 }
 
+//echo22-echo25 in a single pass, for the sample-granular profile:
+//both history samples are read up front, as only tap 7 sees the newest ones
+auto DSP::echoFilter() -> void {
+  state.echoHistoryOffset++;
+
+  state._echoPointer = (uint16)((state._esa << 8) + state.echoOffset);
+  echoRead(0);
+  echoRead(1);
+
+  int coefficient[8];
+  for(uint index : range(8)) coefficient[index] = (int8)REG(FIR + index * 0x10);
+
+  for(uint channel : range(2)) {
+    int sample[8];
+    for(uint index : range(8)) {
+      sample[index] = state.echoHistory[channel][(uint3)(state.echoHistoryOffset + index + 1)];
+    }
+
+    int output = 0;
+    for(uint index : range(7)) output += (sample[index] * coefficient[index]) >> 6;
+    output  = (int16)output;
+    output += (int16)((sample[7] * coefficient[7]) >> 6);
+    state._echoIn[channel] = sclamp<16>(output) & ~1;
+  }
+}
+
 auto DSP::echo22() -> void {
   //history
   state.echoHistoryOffset++;
@@ -1,7 +1,7 @@
 void DSP::serialize(serializer& s) {
   Thread::serialize(s);
 
-  s.array(apuram);
+  s.pages(apuram, sizeof(apuram), apuramPages);
 
   s.array(state.regs, 128);
   s.array(state.echoHistory[0]);
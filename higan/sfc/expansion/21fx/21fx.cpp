@@ -12,6 +12,9 @@ S21FX::S21FX() {
   bus.map({&S21FX::read, this}, {&S21FX::write, this}, "00:fffc-fffd");
 
   booted = false;
+  blockMode = false;
+  snesBuffer.resize(BufferSize + 1);
+  linkBuffer.resize(BufferSize + 1);
 
   for(auto& byte : ram) byte = 0xdb;  //stp
   ram[0] = 0x6c;  //jmp ($fffc)
@@ -25,6 +28,7 @@ S21FX::S21FX() {
   string filename{platform->path(ID::SuperFamicom), "21fx.so"};
   if(link.openAbsolute(filename)) {
     linkInit = link.sym("fx_init");
+    linkInitBlock = link.sym("fx_init_block");  //optional
     linkMain = link.sym("fx_main");
   }
 }
@@ -48,6 +52,7 @@ S21FX::~S21FX() {
 
   if(link.open()) link.close();
   linkInit.reset();
+  linkInitBlock.reset();
   linkMain.reset();
 }
 
@@ -69,6 +74,10 @@ auto S21FX::main() -> void {
     {&S21FX::read, this},
     {&S21FX::write, this}
   );
+  if(linkInitBlock) linkInitBlock(
+    {&S21FX::readBlock, this},
+    {&S21FX::writeBlock, this}
+  );
   if(linkMain) linkMain({});
   while(true) step(10'000'000);
 }
@@ -81,16 +90,23 @@ auto S21FX::read(uint24 addr, uint8 data) -> uint8 {
 
   if(addr >= 0x2184 && addr <= 0x21fd) return ram[addr - 0x2184];
 
+  //in block mode, the link is caught up before every port access, so that a DMA
+  //transfer observes all data the link has produced up to the current CPU cycle
+  if(blockMode && (addr == 0x21fe || addr == 0x21ff)) cpu.synchronize(*this);
+
   if(addr == 0x21fe) return !link.open() ? 0 : (
-    (linkBuffer.size() >    0) << 7  //1 = readable
-  | (snesBuffer.size() < 1024) << 6  //1 = writable
-  | (link.open())              << 5  //1 = connected
+    (linkBuffer.pending()) << 7  //1 = readable
+  | (!snesBuffer.full())   << 6  //1 = writable
+  | (link.open())          << 5  //1 = connected
+  | (blockMode)            << 0  //1 = block mode
   );
 
   if(addr == 0x21ff) {
-    if(linkBuffer.size() > 0) {
-      return linkBuffer.takeLeft();
+    if(linkBuffer.pending()) {
+      return linkBuffer.read();
     }
+    //DMA transfers are fixed-length: pad with zeroes rather than open bus
+    if(blockMode) return 0x00;
   }
 
   return data;
@@ -99,9 +115,15 @@ auto S21FX::read(uint24 addr, uint8 data) -> uint8 {
 auto S21FX::write(uint24 addr, uint8 data) -> void {
   addr &= 0x40ffff;
 
+  if(blockMode && (addr == 0x21fe || addr == 0x21ff)) cpu.synchronize(*this);
+
+  if(addr == 0x21fe) {
+    blockMode = data.bit<0>();
+  }
+
   if(addr == 0x21ff) {
-    if(snesBuffer.size() < 1024) {
-      snesBuffer.append(data);
+    if(!snesBuffer.full()) {
+      snesBuffer.write(data);
     }
   }
 }
@@ -117,19 +139,19 @@ auto S21FX::usleep(uint microseconds) -> void {
 
 auto S21FX::readable() -> bool {
   step(1);
-  return snesBuffer.size() > 0;
+  return snesBuffer.pending();
 }
 
 auto S21FX::writable() -> bool {
   step(1);
-  return linkBuffer.size() < 1024;
+  return !linkBuffer.full();
 }
 
 //SNES -> Link
 auto S21FX::read() -> uint8 {
   step(1);
-  if(snesBuffer.size() > 0) {
-    return snesBuffer.takeLeft();
+  if(snesBuffer.pending()) {
+    return snesBuffer.read();
   }
   return 0x00;
 }
@@ -137,9 +159,28 @@ auto S21FX::read() -> uint8 {
 //Link -> SNES
 auto S21FX::write(uint8 data) -> void {
   step(1);
-  if(linkBuffer.size() < 1024) {
-    linkBuffer.append(data);
+  if(!linkBuffer.full()) {
+    linkBuffer.write(data);
   }
 }
 
+//block transfers are charged a single clock regardless of length:
+//they stand in for the link's own bulk transport, not per-byte handshaking
+
+//SNES -> Link: returns the number of bytes actually transferred
+auto S21FX::readBlock(uint8* data, uint length) -> uint {
+  step(1);
+  uint count = min(length, snesBuffer.count());
+  for(uint n : range(count)) data[n] = snesBuffer.read();
+  return count;
+}
+
+//Link -> SNES: returns the number of bytes actually accepted
+auto S21FX::writeBlock(const uint8* data, uint length) -> uint {
+  step(1);
+  uint count = min(length, BufferSize - linkBuffer.count());
+  for(uint n : range(count)) linkBuffer.write(data[n]);
+  return count;
+}
+
 }
@@ -16,8 +16,14 @@ private:
   auto writable() -> bool;
   auto read() -> uint8;
   auto write(uint8) -> void;
+  auto readBlock(uint8*, uint) -> uint;
+  auto writeBlock(const uint8*, uint) -> uint;
+
+  //each direction buffers up to 64KB, enough for a full bank per transfer
+  enum : uint { BufferSize = 64 * 1024 };
 
   bool booted = false;
+  bool blockMode = false;
   uint16 resetVector;
   uint8 ram[122];
 
@@ -30,8 +36,12 @@ private:
     function<uint8 ()>,     //read
     function<void (uint8)>  //write
   )> linkInit;
+  function<void (
+    function<uint (uint8*, uint)>,       //readBlock
+    function<uint (const uint8*, uint)>  //writeBlock
+  )> linkInitBlock;
   function<void (string_vector)> linkMain;
 
-  vector<uint8> snesBuffer;  //SNES -> Link
-  vector<uint8> linkBuffer;  //Link -> SNES
+  queue<uint8> snesBuffer;  //SNES -> Link
+  queue<uint8> linkBuffer;  //Link -> SNES
 };
@@ -224,6 +224,11 @@ auto Interface::unserialize(serializer& s) -> bool {
   return system.unserialize(s);
 }
 
+auto Interface::serializeIncremental(uint base) -> serializer {
+  system.runToSave();
+  return system.serialize(true, base);
+}
+
 auto Interface::cheatSet(const string_vector& list) -> void {
   cheat.reset();
   #if defined(SFC_SUPERGAMEBOY)
@@ -232,10 +237,31 @@ auto Interface::cheatSet(const string_vector& list) -> void {
   cheat.assign(list);
 }
 
+auto Interface::memoryRegions() -> vector<MemoryRegion> {
+  vector<MemoryRegion> regions;
+  regions.append({"WRAM", (uint8_t*)cpu.wram, sizeof(cpu.wram), 0x7e0000});
+  if(cartridge.has.SA1) regions.append({"BW-RAM", (uint8_t*)sa1.bwram.data(), sa1.bwram.size(), 0x400000});
+  return regions;
+}
+
+auto Interface::profilerTargets() -> vector<ProfilerTarget> {
+  vector<ProfilerTarget> targets;
+  targets.append({"CPU", &cpu.profiler, &cpu});
+  targets.append({"SMP", &smp.profiler, &smp});
+  if(cartridge.has.SA1) targets.append({"SA-1", &sa1.profiler, &sa1});
+  if(cartridge.has.SuperFX) targets.append({"SuperFX", &superfx.profiler, &superfx});
+  if(cartridge.has.ARMDSP) targets.append({"ARM DSP", &armdsp.profiler, &armdsp});
+  if(cartridge.has.HitachiDSP) targets.append({"Hitachi DSP", &hitachidsp.profiler, &hitachidsp});
+  if(cartridge.has.NECDSP) targets.append({"NEC DSP", &necdsp.profiler, &necdsp});
+  return targets;
+}
+
 auto Interface::cap(const string& name) -> bool {
   if(name == "Blur Emulation") return true;
   if(name == "Color Emulation") return true;
   if(name == "Scanline Emulation") return true;
+  if(name == "Fast DSP") return true;
+  if(name == "Random Entropy") return true;
   return false;
 }
 
@@ -243,6 +269,8 @@ auto Interface::get(const string& name) -> any {
   if(name == "Blur Emulation") return settings.blurEmulation;
   if(name == "Color Emulation") return settings.colorEmulation;
   if(name == "Scanline Emulation") return settings.scanlineEmulation;
+  if(name == "Fast DSP") return settings.fastDSP;
+  if(name == "Random Entropy") return settings.random;
   return {};
 }
 
@@ -258,6 +286,8 @@ auto Interface::set(const string& name, const any& value) -> bool {
     return true;
   }
   if(name == "Scanline Emulation" && value.is<bool>()) return settings.scanlineEmulation = value.get<bool>(), true;
+  if(name == "Fast DSP" && value.is<bool>()) return settings.fastDSP = value.get<bool>(), true;
+  if(name == "Random Entropy" && value.is<bool>()) return settings.random = value.get<bool>(), true;
   return false;
 }
 
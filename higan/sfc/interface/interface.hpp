@@ -58,8 +58,11 @@ struct Interface : Emulator::Interface {
 
   auto serialize() -> serializer override;
   auto unserialize(serializer&) -> bool override;
+  auto serializeIncremental(uint base) -> serializer override;
 
   auto cheatSet(const string_vector&) -> void override;
+  auto memoryRegions() -> vector<MemoryRegion> override;
+  auto profilerTargets() -> vector<ProfilerTarget> override;
 
   auto cap(const string& name) -> bool override;
   auto get(const string& name) -> any override;
@@ -70,6 +73,7 @@ struct Settings {
   bool blurEmulation = true;
   bool colorEmulation = true;
   bool scanlineEmulation = true;
+  bool fastDSP = false;  //sample-granular S-DSP: faster, but register writes only take effect between samples
 
   uint controllerPort1 = 0;
   uint controllerPort2 = 0;
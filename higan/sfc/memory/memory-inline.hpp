@@ -18,25 +18,53 @@ auto StaticRAM::operator[](uint24 addr) const -> const uint8& { return _data[add
 //MappedRAM
 
 auto MappedRAM::reset() -> void {
-  delete[] _data;
+  if(_shared) Emulator::ROMCache::release((const uint8_t*)_data);
+  else delete[] _data;
   _data = nullptr;
   _size = 0;
   _writeProtect = false;
+  _shared = false;
+  _pages.resize(0);
 }
 
 auto MappedRAM::allocate(uint size) -> void {
   reset();
   _data = new uint8[_size = size];
+  _pages.resize(_size);
   memory::fill(_data, _size, 0xff);
 }
 
-auto MappedRAM::writeProtect(bool writeProtect) -> void { _writeProtect = writeProtect; }
+//swaps the private copy of a fully loaded ROM for the process-wide shared one
+//the shared image must never be written: it stays write protected until writeProtect(false) copies it back
+auto MappedRAM::share() -> void {
+  if(_shared || !_data) return;
+  auto data = Emulator::ROMCache::acquire((const uint8_t*)_data, _size);
+  delete[] _data;
+  _data = (uint8*)data;
+  _pages.resize(0);
+  _writeProtect = true;
+  _shared = true;
+}
+
+auto MappedRAM::writeProtect(bool writeProtect) -> void {
+  if(_shared && !writeProtect) {
+    auto data = new uint8[_size];
+    memory::copy(data, _data, _size);
+    Emulator::ROMCache::release((const uint8_t*)_data);
+    _data = data;
+    _pages.resize(_size);
+    _shared = false;
+  }
+  _writeProtect = writeProtect;
+}
+
 auto MappedRAM::data() -> uint8* { return _data; }
 auto MappedRAM::size() const -> uint { return _size; }
 
 auto MappedRAM::read(uint24 addr, uint8) -> uint8 { return _data[addr]; }
-auto MappedRAM::write(uint24 addr, uint8 data) -> void { if(!_writeProtect) _data[addr] = data; }
+auto MappedRAM::write(uint24 addr, uint8 data) -> void { if(!_writeProtect) _data[addr] = data, _pages.mark(addr); }
 auto MappedRAM::operator[](uint24 addr) const -> const uint8& { return _data[addr]; }
+auto MappedRAM::serialize(serializer& s) -> void { s.pages(_data, _size, _pages); }
 
 //Bus
 
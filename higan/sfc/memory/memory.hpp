@@ -24,6 +24,7 @@ private:
 struct MappedRAM : Memory {
   inline auto reset() -> void;
   inline auto allocate(uint) -> void;
+  inline auto share() -> void;
 
   inline auto writeProtect(bool writeProtect) -> void;
   inline auto data() -> uint8*;
@@ -32,11 +33,14 @@ struct MappedRAM : Memory {
   inline auto read(uint24 addr, uint8 data = 0) -> uint8;
   inline auto write(uint24 addr, uint8 data) -> void;
   inline auto operator[](uint24 addr) const -> const uint8&;
+  inline auto serialize(serializer&) -> void;
 
 private:
   uint8* _data = nullptr;
   uint _size = 0;
   bool _writeProtect = false;
+  dirtypages _pages;
+  bool _shared = false;
 };
 
 struct Bus {
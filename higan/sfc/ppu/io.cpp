@@ -19,6 +19,7 @@ auto PPU::writeVRAM(bool byte, uint8 data) -> void {
   if(!io.displayDisable && vcounter() < vdisp()) return;
   auto addr = addressVRAM();
   vram[addr].byte(byte) = data;
+  vram.pages.mark(addr & vram.mask);
 }
 
 auto PPU::readOAM(uint10 addr) -> uint8 {
@@ -96,6 +96,7 @@ auto PPU::power(bool reset) -> void {
   bus.map(reader, writer, "00-3f,80-bf:2100-213f");
 
   if(!reset) random.array((uint8*)vram.data, sizeof(vram.data));
+  vram.pages.markAll();
 
   ppu1.mdr = random.bias(0xff);
   ppu2.mdr = random.bias(0xff);
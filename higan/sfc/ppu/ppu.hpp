@@ -33,6 +33,7 @@ private:
     auto& operator[](uint addr) { return data[addr & mask]; }
     uint16 data[64 * 1024];
     uint mask = 0x7fff;
+    dirtypages pages{64 * 1024};
   } vram;
 
   uint32* output = nullptr;
@@ -15,7 +15,7 @@ auto PPU::serialize(serializer& s) -> void {
   PPUcounter::serialize(s);
 
   s.integer(vram.mask);
-  s.array(vram.data, vram.mask + 1);
+  s.pages(vram.data, vram.mask + 1, vram.pages);
 
   s.integer(ppu1.version);
   s.integer(ppu1.mdr);
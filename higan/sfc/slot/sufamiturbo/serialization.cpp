@@ -1,3 +1,3 @@
 auto SufamiTurboCartridge::serialize(serializer& s) -> void {
-  s.array(ram.data(), ram.size());
+  ram.serialize(s);
 }
@@ -6,7 +6,7 @@ alwaysinline auto SMP::ramRead(uint16 addr) -> uint8 {
 
 alwaysinline auto SMP::ramWrite(uint16 addr, uint8 data) -> void {
   //writes to $ffc0-$ffff always go to apuram, even if the iplrom is enabled
-  if(io.ramWritable && !io.ramDisable) dsp.apuram[addr] = data;
+  if(io.ramWritable && !io.ramDisable) dsp.apuram[addr] = data, dsp.apuramPages.mark(addr);
 }
 
 auto SMP::portRead(uint2 port) const -> uint8 {
@@ -96,7 +96,7 @@ auto System::power(bool reset) -> void {
   Emulator::audio.reset();
   Emulator::audio.setInterface(interface);
 
-  random.entropy(Random::Entropy::Low);
+  random.entropy(settings.random ? Random::Entropy::Low : Random::Entropy::None);
 
   scheduler.reset();
   cpu.power(reset);
@@ -0,0 +1,355 @@
+#include "bench.hpp"
+#include <fc/interface/interface.hpp>
+#include <sfc/interface/interface.hpp>
+#include <ms/interface/interface.hpp>
+#include <md/interface/interface.hpp>
+#include <pce/interface/interface.hpp>
+#include <gb/interface/interface.hpp>
+#include <gba/interface/interface.hpp>
+#include <ws/interface/interface.hpp>
+
+#include <sys/resource.h>
+#if defined(ARCHITECTURE_X86) || defined(ARCHITECTURE_AMD64)
+  #include <x86intrin.h>
+#endif
+
+//every operator new, counted to catch allocations in core construction and in dispatch paths.
+//zero-initialized, so allocations made by static constructors before main() are counted as well
+static uint64_t allocations = 0;
+
+auto operator new(size_t size) -> void* {
+  allocations++;
+  if(auto pointer = malloc(size)) return pointer;
+  throw std::bad_alloc();
+}
+
+auto operator delete(void* pointer) noexcept -> void {
+  free(pointer);
+}
+
+#include "workload.cpp"
+#include "report.cpp"
+
+//host cycle counter; falls back to nanoseconds where no cycle counter is available
+static auto cycles() -> uint64_t {
+  #if defined(ARCHITECTURE_X86) || defined(ARCHITECTURE_AMD64)
+  return __rdtsc();
+  #else
+  return chrono::nanosecond();
+  #endif
+}
+
+static auto peakResidentKilobytes() -> uint64_t {
+  struct rusage usage;
+  if(getrusage(RUSAGE_SELF, &usage) != 0) return 0;
+  #if defined(PLATFORM_MACOS)
+  return usage.ru_maxrss / 1024;  //bytes
+  #else
+  return usage.ru_maxrss;  //kilobytes
+  #endif
+}
+
+Program::Program(string_vector arguments) {
+  startupAllocations = allocations;  //every core's static construction
+  Emulator::platform = this;
+  emulators.append(new Famicom::Interface);
+  emulators.append(new SuperFamicom::Interface);
+  emulators.append(new MasterSystem::MasterSystemInterface);
+  emulators.append(new MegaDrive::Interface);
+  emulators.append(new PCEngine::PCEngineInterface);
+  emulators.append(new PCEngine::SuperGrafxInterface);
+  emulators.append(new GameBoy::GameBoyInterface);
+  emulators.append(new GameBoy::GameBoyColorInterface);
+  emulators.append(new GameBoyAdvance::Interface);
+  emulators.append(new MasterSystem::GameGearInterface);
+  emulators.append(new WonderSwan::WonderSwanInterface);
+  emulators.append(new WonderSwan::WonderSwanColorInterface);
+  emulators.append(new WonderSwan::PocketChallengeV2Interface);
+
+  systems = {Path::program(), "systems/"};
+  if(!directory::exists(systems)) systems = {Path::program(), "../systems/"};
+  if(!directory::exists(systems)) systems = {Path::config(), "higan/"};
+
+  vector<Workload> workloads;
+  string output, baseline, movie;
+  double threshold = 5.0;
+
+  arguments.takeLeft();  //ignore program location in argument parsing
+  for(auto& argument : arguments) {
+    if(argument.beginsWith("--frames=")) {
+      benchFrames = max(1, argument.trimLeft("--frames=", 1L).natural());
+    } else if(argument.beginsWith("--warmup=")) {
+      warmupFrames = argument.trimLeft("--warmup=", 1L).natural();
+    } else if(argument.beginsWith("--systems=")) {
+      systems = argument.trimLeft("--systems=", 1L).transform("\\", "/");
+      if(!systems.endsWith("/")) systems.append("/");
+    } else if(argument.beginsWith("--output=")) {
+      output = argument.trimLeft("--output=", 1L);
+    } else if(argument.beginsWith("--compare=")) {
+      baseline = argument.trimLeft("--compare=", 1L);
+    } else if(argument.beginsWith("--threshold=")) {
+      threshold = argument.trimLeft("--threshold=", 1L).real();
+    } else if(argument.beginsWith("--profile=")) {
+      auto part = argument.trimLeft("--profile=", 1L).split(":", 1L);
+      profile = part(0);
+      if(part.size() == 2) profilePeriod = max(1, part[1].natural());
+    } else if(argument.beginsWith("--symbols=")) {
+      symbols = argument.trimLeft("--symbols=", 1L);
+    } else if(argument.beginsWith("--enable=")) {
+      enables.append(argument.trimLeft("--enable=", 1L));
+    } else if(argument.beginsWith("--netplay=")) {
+      netplayLatency = argument.trimLeft("--netplay=", 1L).natural();
+    } else if(argument.beginsWith("--movie=")) {
+      movie = argument.trimLeft("--movie=", 1L);
+    } else if(auto workload = synthetic(argument)) {
+      workload().movie = movie;
+      workloads.append(workload());
+      movie = "";
+    } else if(directory::exists(argument)) {
+      Workload workload;
+      workload.location = argument;
+      workload.name = Location::base(argument).trimRight("/", 1L);
+      workload.type = Location::suffix(workload.name).trimLeft(".", 1L);
+      workload.movie = movie;
+      workloads.append(workload);
+      movie = "";
+    } else {
+      print("unrecognized argument: ", argument, "\n");
+    }
+  }
+
+  if(!workloads) {
+    print("usage: higan-bench [options] workload...\n");
+    print("  workload: game folder (eg \"Super Mario World.sfc/\") or synthetic: sfc-cpu, sfc-ppu\n");
+    print("  --frames=N      emulated frames to measure (default: 600)\n");
+    print("  --warmup=N      frames to run before measuring (default: 60)\n");
+    print("  --movie=file    input movie for the next workload\n");
+    print("  --systems=path  location of the *.sys folders\n");
+    print("  --output=file   write the JSON report to a file instead of stdout\n");
+    print("  --compare=file  compare against a previous JSON report\n");
+    print("  --threshold=N   percentage change treated as a regression (default: 5)\n");
+    print("  --profile=name[:period]\n");
+    print("                  sample the named processor (eg CPU, SMP) every period cycles (default: 1000)\n");
+    print("                  and print flat and call graph reports to stderr\n");
+    print("  --symbols=file  symbol file (address name per line) used to label profiler reports\n");
+    print("  --enable=name   turn on a boolean emulator setting (eg \"Fast DSP\")\n");
+    print("  --netplay=N     measure through a rollback netplay session, with the second port driven\n");
+    print("                  by a scripted remote peer whose inputs arrive N frames late\n");
+    return;
+  }
+
+  vector<Result> results;
+  for(auto& workload : workloads) {
+    if(auto result = run(workload)) {
+      results.append(result());
+    } else {
+      print("failed to run workload: ", workload.name, "\n");
+    }
+  }
+
+  auto document = report(results);
+  if(output) file::write(output, document);
+  else print(document);
+
+  if(baseline && !compare(results, string::read(baseline), threshold)) exit(EXIT_FAILURE);
+}
+
+auto Program::run(Workload& workload) -> maybe<Result> {
+  Emulator::Interface::Medium* medium = nullptr;
+  emulator = nullptr;
+  for(auto& interface : emulators) {
+    for(auto& entry : interface->media) {
+      if(entry.type != workload.type) continue;
+      emulator = interface;
+      medium = &entry;
+      break;
+    }
+    if(emulator) break;
+  }
+  if(!emulator) return nothing;
+
+  movie = {};
+  if(workload.movie && !movie.load(workload.movie)) return nothing;
+
+  this->workload = &workload;
+  paths.reset();
+  paths.append(string{systems, medium->name, ".sys/"});
+
+  Emulator::audio.reset(2, 48000.0);
+  //only the Super Famicom core exposes its entropy; the report flags workloads run without it fixed
+  bool fixedEntropy = emulator->set("Random Entropy", false);
+  for(auto& name : enables) {
+    if(!emulator->set(name, true)) print(stderr, "setting not supported by ", medium->name, ": ", name, "\n");
+  }
+  auto loadAllocations = allocations;
+  if(!emulator->load(medium->id)) return emulator = nullptr, nothing;
+
+  //connect the first real device on every port; movies address inputs by device ID
+  vector<Emulator::Interface::Device*> devices;
+  for(auto& port : emulator->ports) {
+    for(auto& device : port.devices) {
+      if(device.name == "None") continue;
+      emulator->connect(port.id, device.id);
+      devices.append(&device);
+      break;
+    }
+  }
+  emulator->power();
+  loadAllocations = allocations - loadAllocations;
+
+  frames = 0;
+  while(frames < warmupFrames) emulator->run();
+
+  Emulator::Profiler* profiler = nullptr;
+  if(profile) {
+    for(auto& target : emulator->profilerTargets()) {
+      if(target.name != profile) continue;
+      profiler = target.profiler;
+      profiler->reset();
+      profiler->enable(*target.thread, profilePeriod);
+      if(symbols) profiler->loadSymbols(string::read(symbols));
+    }
+    if(!profiler) print(stderr, "no processor named ", profile, " in ", emulator->information.name, "\n");
+  }
+
+  //the remote peer plays the second port, changing its inputs every few frames;
+  //each change reaches the local peer after its prediction ran, forcing a rollback of latency + 1 frames
+  Emulator::Netplay netplay;
+  Emulator::Netplay::LoopbackLink localLink, remoteLink;
+  vector<int16_t> remoteInputs;
+  uint remoteValues = 0;
+  if(netplayLatency && devices.size() >= 2) {
+    localLink.connect(remoteLink, netplayLatency);
+    remoteLink.connect(localLink, netplayLatency);
+    netplay.start(*emulator, *this, localLink);
+    netplay.connect(emulator->ports[0].id, devices[0]->id, true);
+    netplay.connect(emulator->ports[1].id, devices[1]->id, false);
+    remoteValues = devices[1]->inputs.size();
+  } else if(netplayLatency) {
+    print(stderr, "netplay needs two ports: ", workload.name, " measured without it\n");
+  }
+  auto remoteStep = [&] {
+    uint frame = remoteInputs.size() / remoteValues;
+    for(uint n : range(remoteValues)) remoteInputs.append(n == frame / 5 % remoteValues);
+    uint first = frame >= Emulator::Netplay::Redundancy ? frame + 1 - Emulator::Netplay::Redundancy : 0;
+    remoteLink.write(Emulator::Netplay::encode(first, frame + 1 - first, remoteValues, remoteInputs.data() + first * remoteValues));
+    while(remoteLink.read());  //the local peer's inputs are not needed
+  };
+
+  frames = 0;
+  auto frameAllocations = allocations;
+  auto clockStart = cycles();
+  auto timeStart = chrono::nanosecond();
+  if(remoteValues) {
+    while(frames < benchFrames) {
+      netplay.run();
+      remoteStep();
+    }
+  } else {
+    while(frames < benchFrames) emulator->run();
+  }
+  auto timeEnd = chrono::nanosecond();
+  auto clockEnd = cycles();
+  frameAllocations = allocations - frameAllocations;
+  if(remoteValues) netplay.stop();
+
+  if(profiler) {
+    profiler->disable();
+    print(stderr, workload.name, ": ", profile, " profile\n\n");
+    print(stderr, profiler->flatReport(), "\n");
+    print(stderr, profiler->graphReport(), "\n");
+  }
+
+  Result result;
+  result.name = workload.name;
+  result.system = emulator->information.name;
+  result.fixedEntropy = fixedEntropy;
+  result.frames = frames;
+  result.seconds = (timeEnd - timeStart) / 1'000'000'000.0;
+  result.framesPerSecond = result.seconds > 0.0 ? frames / result.seconds : 0.0;
+  result.cyclesPerFrame = (clockEnd - clockStart) / max(1u, frames);
+  result.peakResidentKilobytes = peakResidentKilobytes();
+  result.loadAllocations = loadAllocations;
+  result.allocationsPerFrame = (double)frameAllocations / max(1u, frames);
+  if(remoteValues) result.netplay = netplay.statistics();
+
+  //replay one frame from a full state twice: once to take an incremental state against it,
+  //and once to take the full state that the incremental state must reproduce
+  auto base = emulator->serialize();
+  auto restore = [&](const serializer& state) {
+    serializer s{state.data(), state.size()};
+    return emulator->unserialize(s);
+  };
+  emulator->run();
+  auto incremental = emulator->serializeIncremental(base.generation());
+  restore(base);
+  emulator->run();
+  auto state = emulator->serialize();
+  restore(base);
+  restore(incremental);
+  auto restored = emulator->serialize();
+  result.stateBytes = state.size();
+  result.incrementalStateBytes = incremental.size();
+  result.incrementalStateMatches = restored.size() == state.size() && !memory::compare(restored.data(), state.data(), state.size());
+
+  emulator->unload();
+  emulator = nullptr;
+  this->workload = nullptr;
+  return result;
+}
+
+auto Program::path(uint id) -> string {
+  return paths(id);
+}
+
+auto Program::open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file {
+  //benchmarks never write back to system or game folders
+  if(mode != vfs::file::mode::read) return {};
+
+  if(id != 0 && workload && !workload->location) {
+    if(name == "manifest.bml") {
+      return vfs::memory::file::open(workload->manifest.data<uint8_t>(), workload->manifest.size());
+    }
+    if(name == "program.rom") {
+      return vfs::memory::file::open(workload->program.data(), workload->program.size());
+    }
+    return {};
+  }
+
+  if(name == "manifest.bml" && id != 0 && !file::exists({path(id), name})) {
+    if(auto manifest = execute("icarus", "--manifest", path(id))) {
+      return vfs::memory::file::open(manifest.output.data<uint8_t>(), manifest.output.size());
+    }
+  }
+
+  if(auto result = vfs::fs::file::open({path(id), name}, mode)) return result;
+  if(required) print("missing required file: ", path(id), name, "\n");
+  return {};
+}
+
+auto Program::load(uint id, string name, string type, string_vector options) -> Emulator::Platform::Load {
+  //only the primary medium is available; slotted media (BS Memory, Sufami Turbo, ...) are not benchmarked
+  if(!workload || paths.size() != 1) return {};
+  uint pathID = paths.size();
+  paths.append(workload->location);
+  return {pathID, options(0)};
+}
+
+auto Program::videoRefresh(const uint32* data, uint pitch, uint width, uint height) -> void {
+  movie.advance(++frames);
+}
+
+auto Program::audioSample(const double* samples, uint channels) -> void {
+}
+
+auto Program::inputPoll(uint port, uint device, uint input) -> int16 {
+  return movie.poll(port, device, input);
+}
+
+auto Program::notify(string text) -> void {
+}
+
+#include <nall/main.hpp>
+auto nall::main(string_vector arguments) -> void {
+  Program program{arguments};
+}
@@ -0,0 +1,93 @@
+#include <nall/nall.hpp>
+using namespace nall;
+
+#include <emulator/emulator.hpp>
+#include <emulator/profiler.hpp>
+#include <emulator/netplay.hpp>
+
+struct Workload {
+  string name;      //report key: game folder name or synthetic workload name
+  string type;      //medium extension, used to select the emulator
+  string location;  //game folder; empty for synthetic workloads
+  string movie;     //optional input movie file
+
+  //synthetic workloads are served from memory rather than from a game folder
+  string manifest;
+  vector<uint8_t> program;
+};
+
+struct Result {
+  string name;
+  string system;
+  bool fixedEntropy = false;  //core accepted "Random Entropy" = false (Entropy::None); others seed power-on state their own way
+  uint frames = 0;
+  double seconds = 0.0;
+  double framesPerSecond = 0.0;
+  uint64_t cyclesPerFrame = 0;
+  uint64_t peakResidentKilobytes = 0;
+  uint64_t loadAllocations = 0;      //operator new calls while loading and powering on
+  double allocationsPerFrame = 0.0;  //operator new calls per measured frame
+  uint stateBytes = 0;               //full state
+  uint incrementalStateBytes = 0;    //state holding one frame of changes on top of the full state
+  bool incrementalStateMatches = false;  //full state + incremental state reproduces the full state
+  Emulator::Netplay::Statistics netplay;  //measured frames run through a rollback session, when enabled
+};
+
+struct Movie {
+  auto load(const string& filename) -> bool;
+  auto advance(uint frame) -> void;
+  auto poll(uint port, uint device, uint input) -> int16;
+
+private:
+  struct Event {
+    uint frame;
+    uint port;
+    uint device;
+    uint input;
+    int16_t value;
+  };
+  enum : uint { Ports = 8, Devices = 16, Inputs = 64 };
+  vector<Event> events;
+  uint position = 0;
+  int16_t state[Ports][Devices][Inputs] = {};
+};
+
+struct Program : Emulator::Platform {
+  //bench.cpp
+  Program(string_vector arguments);
+  auto run(Workload& workload) -> maybe<Result>;
+
+  auto path(uint id) -> string override;
+  auto open(uint id, string name, vfs::file::mode mode, bool required) -> vfs::shared::file override;
+  auto load(uint id, string name, string type, string_vector options = {}) -> Emulator::Platform::Load override;
+  auto videoRefresh(const uint32* data, uint pitch, uint width, uint height) -> void override;
+  auto audioSample(const double* samples, uint channels) -> void override;
+  auto inputPoll(uint port, uint device, uint input) -> int16 override;
+  auto notify(string text) -> void override;
+
+  //workload.cpp
+  auto synthetic(const string& name) -> maybe<Workload>;
+  auto superFamicomCPU() -> Workload;
+  auto superFamicomPPU() -> Workload;
+
+  //report.cpp
+  auto report(const vector<Result>& results) -> string;
+  auto compare(const vector<Result>& results, const string& baseline, double threshold) -> bool;
+
+  vector<Emulator::Interface*> emulators;
+  Emulator::Interface* emulator = nullptr;
+  Workload* workload = nullptr;
+  vector<string> paths;  //pathID => folder; 0 = system folder
+  Movie movie;
+  uint frames = 0;
+
+  string systems;  //location of the *.sys folders
+  string profile;  //processor name to profile during the measured frames; empty = disabled
+  uint profilePeriod = 1000;
+  string symbols;  //symbol file used to label profiler reports
+  string_vector enables;  //boolean emulator settings turned on for every workload
+  uint64_t startupAllocations = 0;  //operator new calls before main(), mostly core construction
+  uint warmupFrames = 60;
+  uint benchFrames = 600;
+  uint netplayLatency = 0;  //frames of loopback latency to a scripted remote peer; 0 = netplay disabled
+};
@@ -0,0 +1,74 @@
+//the report is JSON with one workload object per line, so compare() can read it back without a JSON parser
+
+auto Program::report(const vector<Result>& results) -> string {
+  string output;
+  output.append("{\n");
+  output.append("  \"emulator\": \"", Emulator::Name, " v", Emulator::Version, "\",\n");
+  output.append("  \"warmupFrames\": ", warmupFrames, ",\n");
+  output.append("  \"startupAllocations\": ", startupAllocations, ",\n");
+  output.append("  \"workloads\": [\n");
+  for(uint n : range(results.size())) {
+    auto& result = results[n];
+    output.append("    {");
+    output.append("\"name\": \"", result.name, "\", ");
+    output.append("\"system\": \"", result.system, "\", ");
+    output.append("\"fixedEntropy\": ", result.fixedEntropy ? "true" : "false", ", ");
+    output.append("\"frames\": ", result.frames, ", ");
+    output.append("\"seconds\": ", result.seconds, ", ");
+    output.append("\"framesPerSecond\": ", result.framesPerSecond, ", ");
+    output.append("\"cyclesPerFrame\": ", result.cyclesPerFrame, ", ");
+    output.append("\"peakResidentKilobytes\": ", result.peakResidentKilobytes, ", ");
+    output.append("\"loadAllocations\": ", result.loadAllocations, ", ");
+    output.append("\"allocationsPerFrame\": ", result.allocationsPerFrame, ", ");
+    output.append("\"stateBytes\": ", result.stateBytes, ", ");
+    output.append("\"incrementalStateBytes\": ", result.incrementalStateBytes, ", ");
+    output.append("\"incrementalStateMatches\": ", result.incrementalStateMatches ? "true" : "false");
+    auto& netplay = result.netplay;
+    if(netplay.frames) {
+      output.append(", \"netplayStalls\": ", netplay.stalls, ", ");
+      output.append("\"netplayRollbacks\": ", netplay.rollbacks, ", ");
+      output.append("\"netplayMaxRollbackDepth\": ", netplay.maxRollbackDepth, ", ");
+      output.append("\"netplayResimulatedFrames\": ", netplay.resimulatedFrames, ", ");
+      output.append("\"netplayAverageResimulationMilliseconds\": ", netplay.totalResimulationTime / max(1u, netplay.rollbacks) / 1'000'000.0, ", ");
+      output.append("\"netplayMaxResimulationMilliseconds\": ", netplay.maxResimulationTime / 1'000'000.0);
+    }
+    output.append(n + 1 < results.size() ? "},\n" : "}\n");
+  }
+  output.append("  ]\n");
+  output.append("}\n");
+  return output;
+}
+
+//returns false if any workload present in both reports regressed beyond threshold percent
+auto Program::compare(const vector<Result>& results, const string& baseline, double threshold) -> bool {
+  auto field = [](const string& line, const string& name) -> string {
+    auto key = string{"\"", name, "\": "};
+    auto offset = line.find(key);
+    if(!offset) return {};
+    auto value = slice(line, offset() + key.size());
+    if(value.beginsWith("\"")) return slice(value, 1, value.findFrom(1, "\"")(0));
+    if(auto end = value.find(",")) return slice(value, 0, end());
+    if(auto end = value.find("}")) return slice(value, 0, end());
+    return value;
+  };
+
+  bool passed = true;
+  for(auto& line : baseline.split("\n")) {
+    auto name = field(line, "name");
+    if(!name) continue;
+    for(auto& result : results) {
+      if(result.name != name) continue;
+
+      double framesPerSecond = field(line, "framesPerSecond").real();
+      double cyclesPerFrame = field(line, "cyclesPerFrame").real();
+      double speed = framesPerSecond > 0.0 ? (result.framesPerSecond / framesPerSecond - 1.0) * 100.0 : 0.0;
+      double cycles = cyclesPerFrame > 0.0 ? (result.cyclesPerFrame / cyclesPerFrame - 1.0) * 100.0 : 0.0;
+      bool regressed = speed < -threshold || cycles > threshold;
+      if(regressed) passed = false;
+
+      print(regressed ? "REGRESSION: " : "ok: ", name, ": ");
+      print("frames per second ", speed, "%, cycles per frame ", cycles, "%\n");
+    }
+  }
+  return passed;
+}
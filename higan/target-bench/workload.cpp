@@ -0,0 +1,164 @@
+//synthetic workloads are assembled in memory, so the suite does not depend on any commercial software
+
+auto Program::synthetic(const string& name) -> maybe<Workload> {
+  if(name == "sfc-cpu") return superFamicomCPU();
+  if(name == "sfc-ppu") return superFamicomPPU();
+  return nothing;
+}
+
+//minimal 65816 assembler for 32KB LoROM images: code starts at $00:8000, vectors point at an RTI
+struct SuperFamicomAssembler {
+  SuperFamicomAssembler() {
+    image.resize(0x8000, 0xff);
+    pc = 0x8100;
+    emit(0x40);  //rti
+    for(uint address = 0x7fe4; address < 0x8000; address += 2) word(address, 0x8100);
+    word(0x7ffc, 0x8000);  //reset
+    pc = 0x8000;
+  }
+
+  template<typename... P> auto emit(P... p) -> void {
+    for(uint8_t byte : {uint8_t(p)...}) image[pc++ & 0x7fff] = byte;
+  }
+
+  auto label() const -> uint { return pc; }
+
+  //relative branch to a label already emitted
+  auto branch(uint8_t opcode, uint target) -> void {
+    emit(opcode, target - (pc + 2));
+  }
+
+  auto word(uint address, uint16_t data) -> void {
+    image[address + 0] = data >> 0;
+    image[address + 1] = data >> 8;
+  }
+
+  auto manifest(const string& name) const -> string {
+    string output;
+    output.append("game\n");
+    output.append("  sha256: ", Hash::SHA256(image).digest(), "\n");
+    output.append("  label:  ", name, "\n");
+    output.append("  name:   ", name, "\n");
+    output.append("  region: NTSC\n");
+    output.append("  board:  SHVC-1A0N-01\n");
+    output.append("    memory\n");
+    output.append("      type: ROM\n");
+    output.append("      size: 0x", hex(image.size()), "\n");
+    output.append("      content: Program\n");
+    return output;
+  }
+
+  vector<uint8_t> image;
+  uint pc = 0;
+};
+
+//16-bit arithmetic and read-modify-write loop in WRAM, with the display forced blank
+auto Program::superFamicomCPU() -> Workload {
+  SuperFamicomAssembler a;
+  a.emit(0x78);              //sei
+  a.emit(0x18);              //clc
+  a.emit(0xfb);              //xce
+  a.emit(0xc2, 0x30);        //rep #$30
+  a.emit(0xa9, 0x00, 0x00);  //lda #$0000
+  a.emit(0xa2, 0x00, 0x00);  //ldx #$0000
+  auto loop = a.label();
+  a.emit(0x69, 0x34, 0x12);  //adc #$1234
+  a.emit(0x8d, 0x00, 0x00);  //sta $0000
+  a.emit(0xee, 0x02, 0x00);  //inc $0002
+  a.emit(0xca);              //dex
+  a.branch(0x80, loop);      //bra loop
+
+  Workload workload;
+  workload.name = "sfc-cpu";
+  workload.type = "sfc";
+  workload.manifest = a.manifest(workload.name);
+  workload.program = a.image;
+  return workload;
+}
+
+//mode 1 with BG1-3 and OBJ on both screens plus color math, over non-transparent tile data
+auto Program::superFamicomPPU() -> Workload {
+  SuperFamicomAssembler a;
+  a.emit(0x78);                    //sei
+  a.emit(0x18);                    //clc
+  a.emit(0xfb);                    //xce
+  a.emit(0xa9, 0x01);              //lda #$01
+  a.emit(0x8d, 0x05, 0x21);        //sta $2105 (BGMODE)
+  a.emit(0xa9, 0x17);              //lda #$17
+  a.emit(0x8d, 0x2c, 0x21);        //sta $212c (TM)
+  a.emit(0x8d, 0x2d, 0x21);        //sta $212d (TS)
+  a.emit(0xa9, 0x02);              //lda #$02
+  a.emit(0x8d, 0x30, 0x21);        //sta $2130 (CGWSEL)
+  a.emit(0xa9, 0x3f);              //lda #$3f
+  a.emit(0x8d, 0x31, 0x21);        //sta $2131 (CGADSUB)
+
+  a.emit(0xa9, 0x80);              //lda #$80
+  a.emit(0x8d, 0x15, 0x21);        //sta $2115 (VMAIN)
+  a.emit(0x9c, 0x16, 0x21);        //stz $2116 (VMADDL)
+  a.emit(0x9c, 0x17, 0x21);        //stz $2117 (VMADDH)
+  a.emit(0xc2, 0x10);              //rep #$10
+  a.emit(0xa2, 0x00, 0x00);        //ldx #$0000
+  auto fillVRAM = a.label();
+  a.emit(0x8a);                    //txa
+  a.emit(0x8d, 0x18, 0x21);        //sta $2118 (VMDATAL)
+  a.emit(0x8d, 0x19, 0x21);        //sta $2119 (VMDATAH)
+  a.emit(0xe8);                    //inx
+  a.emit(0xe0, 0x00, 0x80);        //cpx #$8000
+  a.branch(0xd0, fillVRAM);        //bne fillVRAM
+
+  a.emit(0x9c, 0x21, 0x21);        //stz $2121 (CGADD)
+  a.emit(0xa2, 0x00, 0x00);        //ldx #$0000
+  auto fillCGRAM = a.label();
+  a.emit(0x8a);                    //txa
+  a.emit(0x8d, 0x22, 0x21);        //sta $2122 (CGDATA)
+  a.emit(0xe8);                    //inx
+  a.emit(0xe0, 0x00, 0x02);        //cpx #$0200
+  a.branch(0xd0, fillCGRAM);       //bne fillCGRAM
+
+  a.emit(0xa9, 0x0f);              //lda #$0f
+  a.emit(0x8d, 0x00, 0x21);        //sta $2100 (INIDISP)
+  auto loop = a.label();
+  a.branch(0x80, loop);            //bra loop
+
+  Workload workload;
+  workload.name = "sfc-ppu";
+  workload.type = "sfc";
+  workload.manifest = a.manifest(workload.name);
+  workload.program = a.image;
+  return workload;
+}
+
+//movie format: one event per line, "frame port device input value"; blank lines and '#' comments are ignored
+//an event takes effect from the given frame onward, until a later event for the same input replaces it
+auto Movie::load(const string& filename) -> bool {
+  events.reset();
+  position = 0;
+  memory::fill(state, sizeof(state));
+
+  if(!file::exists(filename)) return false;
+  for(auto line : string::read(filename).split("\n")) {
+    line.transform("\t", " ").strip();
+    if(!line || line.beginsWith("#")) continue;
+    while(line.find("  ")) line.replace("  ", " ");
+    auto part = line.split(" ");
+    if(part.size() != 5) return false;
+    Event event{(uint)part[0].natural(), (uint)part[1].natural(), (uint)part[2].natural(), (uint)part[3].natural(), (int16_t)part[4].integer()};
+    if(event.port >= Ports || event.device >= Devices || event.input >= Inputs) return false;
+    events.append(event);
+  }
+  sort(events.data(), events.size(), [](const Event& x, const Event& y) { return x.frame < y.frame; });
+  advance(0);
+  return true;
+}
+
+auto Movie::advance(uint frame) -> void {
+  while(position < events.size() && events[position].frame <= frame) {
+    auto& event = events[position++];
+    state[event.port][event.device][event.input] = event.value;
+  }
+}
+
+auto Movie::poll(uint port, uint device, uint input) -> int16 {
+  if(port >= Ports || device >= Devices || input >= Inputs) return 0;
+  return state[port][device][input];
+}
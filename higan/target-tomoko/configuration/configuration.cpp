@@ -16,6 +16,8 @@ Settings::Settings() {
 
   set("Video/Driver", ruby::Video::safestDriver());
   set("Video/Synchronize", false);
+  set("Video/Pacing/Enable", false);
+  set("Video/Pacing/JustInTime", false);
   set("Video/Shader", "Blur");
   set("Video/BlurEmulation", true);
   set("Video/ColorEmulation", true);
@@ -56,6 +58,9 @@ Settings::Settings() {
   set("Input/FocusLoss/Pause", false);
   set("Input/FocusLoss/AllowInput", false);
 
+  set("Exporter/Enable", false);
+  set("Exporter/Name", "higan");
+
   set("Emulation/AutoSaveMemory/Enable", true);
   set("Emulation/AutoSaveMemory/Interval", 30);
 
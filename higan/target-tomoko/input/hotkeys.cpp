@@ -62,12 +62,14 @@ auto InputManager::appendHotkeys() -> void {
   { auto hotkey = new InputHotkey;
     hotkey->name = "Fast Forward";
     hotkey->press = [] {
-      video->setBlocking(false);
-      audio->setBlocking(false);
+      program->fastForward = true;
+      program->updateSynchronization();
+      if(emulator) emulator->set("Fast DSP", true);
     };
     hotkey->release = [] {
-      video->setBlocking(settings["Video/Synchronize"].boolean());
-      audio->setBlocking(settings["Audio/Synchronize"].boolean());
+      program->fastForward = false;
+      program->updateSynchronization();
+      if(emulator) emulator->set("Fast DSP", false);
     };
     hotkeys.append(hotkey);
   }
@@ -52,11 +52,15 @@ Presentation::Presentation() {
   loadShaders();
   synchronizeVideo.setText("Synchronize Video").setChecked(settings["Video/Synchronize"].boolean()).setVisible(false).onToggle([&] {
     settings["Video/Synchronize"].setValue(synchronizeVideo.checked());
-    video->setBlocking(synchronizeVideo.checked());
+    program->updateSynchronization();
   });
   synchronizeAudio.setText("Synchronize Audio").setChecked(settings["Audio/Synchronize"].boolean()).onToggle([&] {
     settings["Audio/Synchronize"].setValue(synchronizeAudio.checked());
-    audio->setBlocking(synchronizeAudio.checked());
+    program->updateSynchronization();
+  });
+  paceFrames.setText("Pace Frames").setChecked(settings["Video/Pacing/Enable"].boolean()).onToggle([&] {
+    settings["Video/Pacing/Enable"].setValue(paceFrames.checked());
+    program->updateSynchronization();
   });
   muteAudio.setText("Mute Audio").setChecked(settings["Audio/Mute"].boolean()).onToggle([&] {
     settings["Audio/Mute"].setValue(muteAudio.checked());
@@ -101,6 +105,7 @@ Presentation::Presentation() {
   loadSlot5.setText("Slot 5").onActivate([&] { program->loadState(5); });
   pauseEmulation.setText("Pause Emulation").onToggle([&] { program->togglePause(); });
   cheatEditor.setIcon(Icon::Edit::Replace).setText("Cheat Editor ...").onActivate([&] { toolsManager->show(0); });
+  ramSearch.setIcon(Icon::Action::Search).setText("RAM Search ...").onActivate([&] { toolsManager->show(4); });
   stateManager.setIcon(Icon::Application::FileManager).setText("State Manager ...").onActivate([&] { toolsManager->show(1); });
   manifestViewer.setIcon(Icon::Emblem::Text).setText("Manifest Viewer ...").onActivate([&] { toolsManager->show(2); });
   gameNotes.setIcon(Icon::Emblem::Text).setText("Game Notes ...").onActivate([&] { toolsManager->show(3); });
@@ -0,0 +1,193 @@
+#if defined(PLATFORM_LINUX)
+  #include <linux/futex.h>
+  #include <sys/syscall.h>
+#endif
+
+//segment layout: Header, then videoSlots * videoSlotSize, audioSlots * audioSlotSize, input table
+//every offset is relative to the start of the segment, and every slot begins on a 64-byte boundary
+
+struct Exporter::Header {
+  char magic[8];  //"higan-ex"
+  uint32_t version;
+  uint32_t size;
+
+  uint32_t videoOffset;
+  uint32_t videoSlots;
+  uint32_t videoSlotSize;
+
+  uint32_t audioOffset;
+  uint32_t audioSlots;
+  uint32_t audioSlotSize;
+  uint32_t audioFrames;
+  uint32_t audioChannels;
+  uint32_t audioFrequency;
+
+  uint32_t inputOffset;
+  uint32_t inputPorts;
+  uint32_t inputDevices;
+  uint32_t inputInputs;
+
+  //the publisher bumps these (and wakes any futex waiters) after a slot is complete
+  alignas(64) std::atomic<uint32_t> videoSequence;
+  alignas(64) std::atomic<uint32_t> audioSequence;
+
+  //written by the consumer: when non-zero, inputPoll() reads the input table instead of local devices
+  alignas(64) std::atomic<uint32_t> inputEnable;
+};
+
+//slot sequence is zero while the slot is being written, and the published sequence number otherwise
+struct Exporter::VideoSlot {
+  std::atomic<uint32_t> sequence;
+  uint32_t width;
+  uint32_t height;
+  uint32_t pitch;
+  alignas(64) uint32_t pixels[];
+};
+
+struct Exporter::AudioSlot {
+  std::atomic<uint32_t> sequence;
+  uint32_t frames;
+  alignas(64) float samples[];
+};
+
+Exporter::~Exporter() {
+  close();
+}
+
+Exporter::operator bool() const {
+  return header;
+}
+
+auto Exporter::open(const string& name, Emulator::Interface& interface) -> bool {
+  close();
+
+  auto information = interface.videoInformation();
+  uint pixels = information.internalWidth * information.internalHeight;
+  if(!pixels) return false;
+
+  uint ports = interface.ports.size();
+  uint devices = 0, inputs = 0;
+  for(auto& port : interface.ports) {
+    for(auto& device : port.devices) {
+      devices = max(devices, device.id + 1);
+      inputs = max(inputs, (uint)device.inputs.size());
+    }
+  }
+
+  auto align = [](uint size) -> uint { return size + 63 & ~63; };
+  videoSlotSize = align(sizeof(VideoSlot) + pixels * sizeof(uint32_t));
+  audioSlotSize = align(sizeof(AudioSlot) + AudioFrames * AudioChannels * sizeof(float));
+  uint videoOffset = align(sizeof(Header));
+  uint audioOffset = videoOffset + VideoSlots * videoSlotSize;
+  uint inputOffset = audioOffset + AudioSlots * audioSlotSize;
+  uint size = inputOffset + align(ports * devices * inputs * sizeof(int16_t));
+
+  if(!segment.create(name, size)) return false;
+  auto data = segment.data();
+
+  header = new(data) Header;
+  memory::copy(header->magic, "higan-ex", 8);
+  header->version = Version;
+  header->size = size;
+  header->videoOffset = videoOffset;
+  header->videoSlots = VideoSlots;
+  header->videoSlotSize = videoSlotSize;
+  header->audioOffset = audioOffset;
+  header->audioSlots = AudioSlots;
+  header->audioSlotSize = audioSlotSize;
+  header->audioFrames = AudioFrames;
+  header->audioChannels = AudioChannels;
+  header->audioFrequency = settings["Audio/Frequency"].natural();
+  header->inputOffset = inputOffset;
+  header->inputPorts = ports;
+  header->inputDevices = devices;
+  header->inputInputs = inputs;
+  header->videoSequence = 0;
+  header->audioSequence = 0;
+  header->inputEnable = 0;
+
+  videoSlots = data + videoOffset;
+  audioSlots = data + audioOffset;
+  inputTable = (const int16_t*)(data + inputOffset);
+  maximumPixels = pixels;
+  videoSequence = 0;
+  audioSequence = 0;
+  audioSlot = nullptr;
+  return true;
+}
+
+auto Exporter::close() -> void {
+  if(!header) return;
+  //let blocked consumers observe the segment going away
+  header->videoSequence = ~0u;
+  header->audioSequence = ~0u;
+  wake(header->videoSequence);
+  wake(header->audioSequence);
+  segment.reset();
+  header = nullptr;
+  videoSlots = nullptr;
+  audioSlots = nullptr;
+  inputTable = nullptr;
+  audioSlot = nullptr;
+}
+
+auto Exporter::video(const uint32* data, uint pitch, uint width, uint height) -> void {
+  if(!header || width * height > maximumPixels) return;
+
+  uint32_t sequence = ++videoSequence;
+  if(!sequence) sequence = ++videoSequence;  //zero is reserved for "slot being written"
+  auto slot = (VideoSlot*)(videoSlots + (sequence % VideoSlots) * videoSlotSize);
+
+  slot->sequence.store(0, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  slot->width = width;
+  slot->height = height;
+  slot->pitch = width * sizeof(uint32_t);
+  pitch >>= 2;
+  for(uint y : range(height)) {
+    memory::copy(slot->pixels + y * width, data + y * pitch, width * sizeof(uint32_t));
+  }
+  slot->sequence.store(sequence, std::memory_order_release);
+
+  header->videoSequence.store(sequence, std::memory_order_release);
+  wake(header->videoSequence);
+}
+
+auto Exporter::audio(const double* samples, uint channels) -> void {
+  if(!header) return;
+
+  if(!audioSlot) {
+    uint32_t sequence = audioSequence + 1;
+    if(!sequence) sequence++;
+    audioSlot = (AudioSlot*)(audioSlots + (sequence % AudioSlots) * audioSlotSize);
+    audioSlot->sequence.store(0, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+    audioSlot->frames = 0;
+  }
+
+  auto output = audioSlot->samples + audioSlot->frames * AudioChannels;
+  for(uint c : range(AudioChannels)) output[c] = samples[c < channels ? c : 0];
+  if(++audioSlot->frames < AudioFrames) return;
+
+  uint32_t sequence = ++audioSequence;
+  if(!sequence) sequence = ++audioSequence;
+  audioSlot->sequence.store(sequence, std::memory_order_release);
+  audioSlot = nullptr;
+
+  header->audioSequence.store(sequence, std::memory_order_release);
+  wake(header->audioSequence);
+}
+
+auto Exporter::input(uint port, uint device, uint input) -> maybe<int16> {
+  if(!header || !header->inputEnable.load(std::memory_order_acquire)) return nothing;
+  if(port >= header->inputPorts || device >= header->inputDevices || input >= header->inputInputs) return nothing;
+  uint index = (port * header->inputDevices + device) * header->inputInputs + input;
+  return (int16)inputTable[index];
+}
+
+//consumers may sleep on the sequence words with FUTEX_WAIT; the segment is shared, so no FUTEX_PRIVATE_FLAG
+auto Exporter::wake(std::atomic<uint32_t>& word) -> void {
+  #if defined(PLATFORM_LINUX)
+  syscall(SYS_futex, (uint32_t*)&word, FUTEX_WAKE, INT_MAX, nullptr, nullptr, 0);
+  #endif
+}
@@ -54,6 +54,8 @@ auto Program::videoRefresh(const uint32* data, uint pitch, uint width, uint heig
   uint32_t* output;
   uint length;
 
+  if(exporter) exporter.video(data, pitch, width, height);
+
   pitch >>= 2;
 
   if(emulator->information.overscan) {
@@ -86,15 +88,20 @@ auto Program::videoRefresh(const uint32* data, uint pitch, uint width, uint heig
   if(current != previous) {
     previous = current;
     statusText = {"FPS: ", frameCounter};
+    if(settings["Video/Pacing/Enable"].boolean()) statusText.append(", missed: ", framePacer.missed);
     frameCounter = 0;
   }
 }
 
 auto Program::audioSample(const double* samples, uint channels) -> void {
+  if(exporter) exporter.audio(samples, channels);
   audio->output(samples);
 }
 
 auto Program::inputPoll(uint port, uint device, uint input) -> int16 {
+  if(exporter) {
+    if(auto value = exporter.input(port, device, input)) return value();
+  }
   if(focused() || settings["Input/FocusLoss/AllowInput"].boolean()) {
     inputManager->poll();
     if(auto mapping = inputManager->mapping(port, device, input)) {
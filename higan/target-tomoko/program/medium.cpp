@@ -30,6 +30,11 @@ auto Program::loadMedium(Emulator::Interface& interface, const Emulator::Interfa
   updateAudioEffects();
   connectDevices();
   emulator->power();
+  framePacer.reset(emulator->videoInformation().refreshRate);
+  traceStartup({"load ", medium.name});
+  if(settings["Exporter/Enable"].boolean()) {
+    if(!exporter.open(settings["Exporter/Name"].text(), *emulator)) showMessage("Failed to create shared memory exporter");
+  }
 
   presentation->resizeViewport();
   presentation->setTitle(emulator->title());
@@ -40,6 +45,7 @@ auto Program::loadMedium(Emulator::Interface& interface, const Emulator::Interfa
   toolsManager->stateManager.doRefresh();
   toolsManager->manifestViewer.doRefresh();
   toolsManager->gameNotes.loadNotes();
+  toolsManager->ramSearch.doReset();
 }
 
 auto Program::unloadMedium() -> void {
@@ -48,9 +54,12 @@ auto Program::unloadMedium() -> void {
   presentation->clearViewport();
   toolsManager->cheatEditor.saveCheats();
   toolsManager->gameNotes.saveNotes();
+  exporter.close();
+  if(tracePacing && framePacer.frames) print(stderr, "[pacing] ", emulator->information.name, "\n", framePacer.report());
   emulator->unload();
   emulator = nullptr;
   mediumPaths.reset();
+  toolsManager->ramSearch.doReset();
 
   presentation->resizeViewport();
   presentation->setTitle({"higan v", Emulator::Version});
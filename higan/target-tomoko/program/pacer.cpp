@@ -0,0 +1,85 @@
+//the final stretch before a deadline is spun rather than slept, since a sleeping thread may wake up to a scheduler tick late
+static constexpr uint64_t PacerSpinTime = 1'000'000;
+//just-in-time frames start this much earlier than the slowest recent frame needed
+static constexpr uint64_t PacerSafetyMargin = 2'000'000;
+
+auto FramePacer::reset(double refreshRate) -> void {
+  period = refreshRate > 0.0 ? 1'000'000'000.0 / refreshRate : 1'000'000'000 / 60;
+  deadline = 0;
+  presented = 0;
+  started = 0;
+  estimate = 0;
+  frames = 0;
+  missed = 0;
+  for(auto& bucket : histogram) bucket = 0;
+}
+
+auto FramePacer::setJustInTime(bool justInTime) -> void {
+  this->justInTime = justInTime;
+}
+
+auto FramePacer::wait() -> void {
+  auto now = chrono::nanosecond();
+  if(!deadline) deadline = now + period;
+
+  //frames start as soon as the previous one was due, or else as late as they can while still finishing in time
+  uint64_t start = deadline - period;
+  if(justInTime) start = deadline - min(period, estimate + PacerSafetyMargin);
+  sleepUntil(start);
+  started = chrono::nanosecond();
+}
+
+auto FramePacer::finish() -> void {
+  auto now = chrono::nanosecond();
+  auto cost = now - started;
+  //a decaying peak: one slow frame raises the estimate at once, and it relaxes over the following frames
+  estimate = max(cost, estimate - estimate / 16);
+
+  frames++;
+  if(now > deadline) missed++;
+  if(presented) {
+    auto error = (int64_t)(now - presented) - (int64_t)period;
+    auto bucket = (int)Buckets / 2 + (error >= 0 ? error + BucketWidth / 2 : error - BucketWidth / 2) / (int64_t)BucketWidth;
+    histogram[max(0, min((int)Buckets - 1, (int)bucket))]++;
+  }
+  presented = now;
+
+  //after a stall (breakpoints, loading states, a descheduled process), start over rather than running frames back to back
+  deadline += period;
+  if(now > deadline) deadline = now + period;
+}
+
+auto FramePacer::idle() -> void {
+  deadline = 0;
+  presented = 0;
+  sleepUntil(chrono::nanosecond() + max(period, (uint64_t)20'000'000));
+}
+
+auto FramePacer::report() const -> string {
+  string output;
+  output.append("frames: ", frames, ", missed deadlines: ", missed, "\n");
+  output.append("frame interval minus period (ms):\n");
+  uint peak = 1;
+  for(auto count : histogram) peak = max(peak, count);
+  for(uint n : range(Buckets)) {
+    auto center = ((int)n - (int)Buckets / 2) * (int64_t)BucketWidth / 1'000'000.0;
+    string label = {n == 0 ? "<=" : n == Buckets - 1 ? ">=" : "  ", center >= 0 ? "+" : "", center};
+    output.append(pad(label, 8L), " ", pad(histogram[n], 6L), " ", string::repeat("*", histogram[n] * 50 / peak), "\n");
+  }
+  return output;
+}
+
+auto FramePacer::sleepUntil(uint64_t time) -> void {
+  auto now = chrono::nanosecond();
+  if(time > now + PacerSpinTime) {
+    #if defined(PLATFORM_LINUX) || defined(PLATFORM_BSD)
+    timespec target;
+    target.tv_sec = (time - PacerSpinTime) / 1'000'000'000;
+    target.tv_nsec = (time - PacerSpinTime) % 1'000'000'000;
+    while(clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &target, nullptr) == EINTR);
+    #else
+    usleep((time - PacerSpinTime - now) / 1'000);
+    #endif
+  }
+  while(chrono::nanosecond() < time);
+}
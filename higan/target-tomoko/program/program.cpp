@@ -8,6 +8,8 @@
 #include <gba/interface/interface.hpp>
 #include <ws/interface/interface.hpp>
 #include "interface.cpp"
+#include "exporter.cpp"
+#include "pacer.cpp"
 #include "medium.cpp"
 #include "state.cpp"
 #include "utility.cpp"
@@ -15,6 +17,7 @@ unique_pointer<Program> program;
 
 Program::Program(string_vector args) {
   program = this;
+  tracePacing = (bool)args.find("--trace-pacing");
 
   Emulator::platform = this;
   emulators.append(new Famicom::Interface);
@@ -30,9 +33,11 @@ Program::Program(string_vector args) {
   emulators.append(new WonderSwan::WonderSwanInterface);
   emulators.append(new WonderSwan::WonderSwanColorInterface);
   emulators.append(new WonderSwan::PocketChallengeV2Interface);
+  traceStartup("interfaces");
 
   new Presentation;
   presentation->setVisible();
+  traceStartup("presentation");
 
   if(settings["Crashed"].boolean()) {
     MessageDialog().setText("Driver crash detected. Video/Audio/Input drivers have been disabled.").information();
@@ -47,6 +52,7 @@ Program::Program(string_vector args) {
   initializeVideoDriver();
   initializeAudioDriver();
   initializeInputDriver();
+  traceStartup("drivers");
 
   settings["Crashed"].setValue(false);
   settings.save();
@@ -57,6 +63,7 @@ Program::Program(string_vector args) {
   new CheatDatabase;
   new ToolsManager;
   new AboutWindow;
+  traceStartup("windows");
 
   updateVideoShader();
   updateAudioDriver();
@@ -76,6 +83,7 @@ Program::Program(string_vector args) {
     }
   }
   loadMedium();
+  traceStartup("ready");
 
   Application::onMain({&Program::main, this});
 }
@@ -87,11 +95,14 @@ auto Program::main() -> void {
 
   if(!emulator || !emulator->loaded() || pause || (!focused() && settings["Input/FocusLoss/Pause"].boolean())) {
     audio->clear();
-    usleep(20 * 1000);
+    framePacer.idle();
     return;
   }
 
+  bool pacing = settings["Video/Pacing/Enable"].boolean() && !fastForward;
+  if(pacing) framePacer.wait();
   emulator->run();
+  if(pacing) framePacer.finish();
   if(settings["Emulation/AutoSaveMemory/Enable"].boolean()) {
     time_t currentTime = time(nullptr);
     if(currentTime - autoSaveTime >= settings["Emulation/AutoSaveMemory/Interval"].natural()) {
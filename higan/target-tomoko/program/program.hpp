@@ -1,3 +1,63 @@
+//publishes frames and audio blocks to, and reads controller input from, a POSIX shared-memory segment
+struct Exporter {
+  enum : uint { Version = 1, VideoSlots = 4, AudioSlots = 16, AudioFrames = 512, AudioChannels = 2 };
+
+  ~Exporter();
+
+  explicit operator bool() const;
+  auto open(const string& name, Emulator::Interface& interface) -> bool;
+  auto close() -> void;
+
+  auto video(const uint32* data, uint pitch, uint width, uint height) -> void;
+  auto audio(const double* samples, uint channels) -> void;
+  auto input(uint port, uint device, uint input) -> maybe<int16>;
+
+private:
+  struct Header;
+  struct VideoSlot;
+  struct AudioSlot;
+
+  auto wake(std::atomic<uint32_t>& word) -> void;
+
+  shared_memory segment;
+  Header* header = nullptr;
+  uint8_t* videoSlots = nullptr;
+  uint8_t* audioSlots = nullptr;
+  const int16_t* inputTable = nullptr;
+  uint videoSlotSize = 0;
+  uint audioSlotSize = 0;
+  uint maximumPixels = 0;
+  uint32_t videoSequence = 0;
+  uint32_t audioSequence = 0;
+  AudioSlot* audioSlot = nullptr;  //block currently being filled
+};
+
+//sleeps until each frame is due at the emulated system's refresh rate, for hosts that cannot synchronize to vertical blank
+struct FramePacer {
+  enum : uint { Buckets = 17, BucketWidth = 500'000 };  //frame interval error histogram: 0.5ms buckets around the period
+
+  auto reset(double refreshRate) -> void;
+  auto setJustInTime(bool justInTime) -> void;
+  auto wait() -> void;    //before running a frame
+  auto finish() -> void;  //after the frame has been output
+  auto idle() -> void;    //while paused, in place of running a frame
+  auto report() const -> string;
+
+  uint frames = 0;
+  uint missed = 0;  //frames output after their deadline
+  uint histogram[Buckets] = {};
+
+private:
+  auto sleepUntil(uint64_t time) -> void;
+
+  uint64_t period = 1'000'000'000 / 60;
+  uint64_t deadline = 0;   //when the next frame is due; 0 = not started
+  uint64_t presented = 0;  //when the last frame was output
+  uint64_t started = 0;    //when the current frame began running
+  uint64_t estimate = 0;   //recent peak time taken by a frame
+  bool justInTime = false;
+};
+
 struct Program : Emulator::Platform {
   //program.cpp
   Program(string_vector args);
@@ -41,10 +101,15 @@ struct Program : Emulator::Platform {
   auto updateVideoShader() -> void;
   auto updateAudioDriver() -> void;
   auto updateAudioEffects() -> void;
+  auto updateSynchronization() -> void;
   auto focused() -> bool;
 
+  Exporter exporter;
+  FramePacer framePacer;
+
   bool hasQuit = false;
   bool pause = false;
+  bool fastForward = false;
 
   vector<Emulator::Interface*> emulators;
 
@@ -52,6 +117,7 @@ struct Program : Emulator::Platform {
   vector<string> mediumPaths;  //for keeping track of loaded folder locations
 
   time_t autoSaveTime = 0;  //for automatically saving RAM periodically
+  bool tracePacing = false;  //--trace-pacing: print frame pacing statistics when a game is unloaded
 
   string statusText;
   string statusMessage;
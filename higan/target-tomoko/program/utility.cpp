@@ -5,12 +5,11 @@ auto Program::initializeVideoDriver() -> void {
   video = Video::create(settings["Video/Driver"].text());
   video->setContext(presentation->viewport.handle());
 
-  video->setBlocking(settings["Video/Synchronize"].boolean());
-
   if(!video->ready()) {
     MessageDialog().setText("Failed to initialize video driver").warning();
     video = Video::create("None");
   }
+  updateSynchronization();
 
   presentation->clearViewport();
 }
@@ -39,12 +38,12 @@ auto Program::initializeAudioDriver() -> void {
 
   audio->setChannels(2);
   audio->setExclusive(settings["Audio/Exclusive"].boolean());
-  audio->setBlocking(settings["Audio/Synchronize"].boolean());
 
   if(!audio->ready()) {
     MessageDialog().setText("Failed to initialize audio driver").warning();
     audio = Audio::create("None");
   }
+  updateSynchronization();
 
   Emulator::audio.setFrequency(settings["Audio/Frequency"].real());
 }
@@ -178,6 +177,15 @@ auto Program::updateAudioEffects() -> void {
   Emulator::audio.setReverb(reverbEnable);
 }
 
+//the only place driver blocking is decided: frame pacing replaces it, and fast forwarding disables both.
+//called whenever a driver is created, so either driver may not exist yet
+auto Program::updateSynchronization() -> void {
+  bool pacing = settings["Video/Pacing/Enable"].boolean();
+  if(video) video->setBlocking(!fastForward && !pacing && settings["Video/Synchronize"].boolean());
+  if(audio) audio->setBlocking(!fastForward && !pacing && settings["Audio/Synchronize"].boolean());
+  framePacer.setJustInTime(settings["Video/Pacing/JustInTime"].boolean());
+}
+
 auto Program::focused() -> bool {
   //exclusive mode creates its own top-level window: presentation window will not have focus
   if(video->exclusive()) return true;
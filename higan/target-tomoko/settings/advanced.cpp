@@ -48,4 +48,8 @@ AdvancedSettings::AdvancedSettings(TabFrame* parent) : TabFrameItem(parent) {
   autoSaveMemory.setText("Auto-Save Memory Periodically").setChecked(settings["Emulation/AutoSaveMemory/Enable"].boolean()).onToggle([&] {
     settings["Emulation/AutoSaveMemory/Enable"].setValue(autoSaveMemory.checked());
   });
+  justInTimeFrames.setText("Run Paced Frames Just In Time").setChecked(settings["Video/Pacing/JustInTime"].boolean()).onToggle([&] {
+    settings["Video/Pacing/JustInTime"].setValue(justInTimeFrames.checked());
+    program->updateSynchronization();
+  });
 }
@@ -186,6 +186,7 @@ struct AdvancedSettings : TabFrameItem {
     CheckLabel ignoreManifests{&layout, Size{~0, 0}};
     Label otherLabel{&layout, Size{~0, 0}, 2};
     CheckLabel autoSaveMemory{&layout, Size{~0, 0}};
+    CheckLabel justInTimeFrames{&layout, Size{~0, 0}};
 };
 
 struct SettingsManager : Window {
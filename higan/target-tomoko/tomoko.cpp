@@ -4,6 +4,10 @@ unique_pointer<Audio> audio;
 unique_pointer<Input> input;
 Emulator::Interface* emulator = nullptr;
 
+//taken while the first object linked is statically constructed, before any emulation core;
+//cleared in main() unless --trace-startup is given
+uint64_t startupTime = chrono::nanosecond();
+
 auto locate(string name) -> string {
   string location = {Path::program(), name};
   if(inode::exists(location)) return location;
@@ -15,8 +19,16 @@ auto locate(string name) -> string {
   return {Path::local(), "higan/", name};
 }
 
+//--trace-startup: print milliseconds elapsed since the process began
+auto traceStartup(const string& event) -> void {
+  if(!startupTime) return;
+  print(stderr, "[startup] ", event, ": ", (chrono::nanosecond() - startupTime) / 1'000'000.0, "ms\n");
+}
+
 #include <nall/main.hpp>
 auto nall::main(string_vector args) -> void {
+  if(!args.find("--trace-startup")) startupTime = 0;
+  traceStartup("main");
   Application::setName("higan");
   new Program(args);
   Application::run();
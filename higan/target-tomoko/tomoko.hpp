@@ -1,4 +1,5 @@
 #include <nall/nall.hpp>
+#include <nall/shared-memory.hpp>
 #include <ruby/ruby.hpp>
 #include <hiro/hiro.hpp>
 using namespace nall;
@@ -10,6 +11,7 @@ extern unique_pointer<Input> input;
 
 #include <emulator/emulator.hpp>
 extern Emulator::Interface* emulator;
+extern uint64_t startupTime;
 
 #include "program/program.hpp"
 #include "configuration/configuration.hpp"
@@ -19,3 +21,4 @@ extern Emulator::Interface* emulator;
 #include "presentation/presentation.hpp"
 
 auto locate(string name) -> string;
+auto traceStartup(const string& event) -> void;
@@ -0,0 +1,180 @@
+#if defined(__SSE2__)
+  #include <emmintrin.h>
+#endif
+
+RAMSearch::RAMSearch(TabFrame* parent) : TabFrameItem(parent) {
+  setIcon(Icon::Action::Search);
+  setText("RAM Search");
+
+  layout.setMargin(5);
+  resultList.onChange([&] { addCheatButton.setEnabled((bool)resultList.selected()); });
+  resultList.onActivate([&] { doAddCheat(); });
+  compareOption.append(ComboButtonItem().setText("Equal"));
+  compareOption.append(ComboButtonItem().setText("Changed"));
+  compareOption.append(ComboButtonItem().setText("Greater"));
+  compareOption.append(ComboButtonItem().setText("Less"));
+  compareOption.append(ComboButtonItem().setText("Delta"));
+  compareOption.append(ComboButtonItem().setText("Value"));
+  compareOption.onChange([&] {
+    auto compare = (Compare)compareOption.selected().offset();
+    compareValue.setEnabled(compare == Compare::Delta || compare == Compare::Value);
+  });
+  compareValue.setEnabled(false).setText("0");
+  filterButton.setText("Filter").onActivate([&] { doFilter(); });
+  addCheatButton.setText("Add Cheat").setEnabled(false).onActivate([&] { doAddCheat(); });
+  resetButton.setText("Reset").onActivate([&] { doReset(); });
+
+  doRefresh();
+}
+
+//snapshots every region and marks every byte within it as a candidate
+auto RAMSearch::doReset() -> void {
+  regions.reset();
+  if(emulator) {
+    for(auto& source : emulator->memoryRegions()) {
+      Region region;
+      region.source = source;
+      uint words = (source.size + 63) / 64;
+      region.snapshot.resize(words * 64);
+      memory::copy(region.snapshot.data(), source.data, source.size);
+      region.candidates.resize(words, ~0ull);
+      if(source.size & 63) region.candidates[words - 1] = (1ull << (source.size & 63)) - 1;
+      region.count = source.size;
+      regions.append(region);
+    }
+  }
+  doRefresh();
+}
+
+auto RAMSearch::doFilter() -> void {
+  if(!regions) doReset();
+  auto compare = (Compare)compareOption.selected().offset();
+  uint8_t value = compareValue.text().strip().hex();
+  for(auto& region : regions) {
+    switch(compare) {
+    case Compare::Equal:    filter<Compare::Equal   >(region, value); break;
+    case Compare::NotEqual: filter<Compare::NotEqual>(region, value); break;
+    case Compare::Greater:  filter<Compare::Greater >(region, value); break;
+    case Compare::Less:     filter<Compare::Less    >(region, value); break;
+    case Compare::Delta:    filter<Compare::Delta   >(region, value); break;
+    case Compare::Value:    filter<Compare::Value   >(region, value); break;
+    }
+  }
+  doRefresh();
+}
+
+auto RAMSearch::doRefresh() -> void {
+  resultList.reset();
+  resultList.append(TableViewHeader().setVisible()
+    .append(TableViewColumn().setText("Address").setForegroundColor({0, 128, 0}))
+    .append(TableViewColumn().setText("Region"))
+    .append(TableViewColumn().setText("Previous").setAlignment(1.0))
+    .append(TableViewColumn().setText("Current").setAlignment(1.0).setExpandable())
+  );
+
+  uint count = 0, listed = 0;
+  results.reset();
+  for(auto& region : regions) {
+    count += region.count;
+    for(uint word : range(region.candidates.size())) {
+      for(uint64_t mask = region.candidates[word]; mask && listed < ListLimit; mask &= mask - 1) {
+        uint offset = word * 64 + __builtin_ctzll(mask);
+        uint address = region.source.address + offset;
+        resultList.append(TableViewItem()
+          .append(TableViewCell().setText(hex(address, digits(address))))
+          .append(TableViewCell().setText(region.source.name))
+          .append(TableViewCell().setText(hex(region.snapshot[offset], 2L)))
+          .append(TableViewCell().setText(hex(region.source.data[offset], 2L)))
+        );
+        results.append({address, region.source.data[offset]});
+        listed++;
+      }
+    }
+  }
+
+  countLabel.setText({count, count == 1 ? " candidate" : " candidates"});
+  addCheatButton.setEnabled(false);
+  resultList.resizeColumns();
+}
+
+auto RAMSearch::doAddCheat() -> void {
+  if(auto item = resultList.selected()) {
+    auto& result = results[item.offset()];
+    string code = {hex(result.address, digits(result.address)), "=", hex(result.data, 2L)};
+    if(toolsManager->cheatEditor.addCode(code, "RAM Search")) {
+      toolsManager->cheatEditor.doRefresh();
+    }
+  }
+}
+
+//width of an address as written in cheat codes for the current system
+auto RAMSearch::digits(uint address) -> uint {
+  if(address > 0xffffff) return 8;
+  if(address > 0xffff) return 6;
+  return 4;
+}
+
+//narrows the candidate bitset of a region to addresses whose current value satisfies the comparison
+//the previous snapshot is then replaced, so the next filter compares against this moment in time
+template<RAMSearch::Compare compare> auto RAMSearch::filter(Region& region, uint8_t value) -> void {
+  auto current = region.source.data;
+  auto previous = region.snapshot.data();
+  auto candidates = region.candidates.data();
+  uint words = region.candidates.size();
+  uint tail = region.source.size & 63;
+  uint count = 0;
+
+  for(uint word : range(words)) {
+    uint64_t mask = candidates[word];
+    if(!mask) continue;  //sparse candidate sets skip whole 64-byte blocks
+    uint offset = word * 64;
+    if(tail && word == words - 1) {
+      uint8_t block[64] = {};
+      memory::copy(block, current + offset, tail);
+      mask &= match<compare>(block, previous + offset, value);
+    } else {
+      mask &= match<compare>(current + offset, previous + offset, value);
+    }
+    candidates[word] = mask;
+    count += __builtin_popcountll(mask);
+  }
+
+  memory::copy(previous, current, region.source.size);
+  region.count = count;
+}
+
+//returns one bit per byte of a 64-byte block
+template<RAMSearch::Compare compare> auto RAMSearch::match(const uint8_t* current, const uint8_t* previous, uint8_t value) -> uint64_t {
+  uint64_t result = 0;
+
+  #if defined(__SSE2__)
+  const __m128i operand = _mm_set1_epi8(value);
+  const __m128i zero = _mm_setzero_si128();
+  for(uint n = 0; n < 64; n += 16) {
+    __m128i x = _mm_loadu_si128((const __m128i*)(current + n));
+    __m128i y = _mm_loadu_si128((const __m128i*)(previous + n));
+    uint bits = 0;
+    if(compare == Compare::Equal   ) bits = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y));
+    if(compare == Compare::NotEqual) bits = _mm_movemask_epi8(_mm_cmpeq_epi8(x, y)) ^ 0xffff;
+    if(compare == Compare::Greater ) bits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(x, y), zero)) ^ 0xffff;
+    if(compare == Compare::Less    ) bits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_subs_epu8(y, x), zero)) ^ 0xffff;
+    if(compare == Compare::Delta   ) bits = _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_sub_epi8(x, y), operand));
+    if(compare == Compare::Value   ) bits = _mm_movemask_epi8(_mm_cmpeq_epi8(x, operand));
+    result |= (uint64_t)bits << n;
+  }
+  #else
+  for(uint n : range(64)) {
+    uint8_t x = current[n], y = previous[n];
+    bool bit = false;
+    if(compare == Compare::Equal   ) bit = x == y;
+    if(compare == Compare::NotEqual) bit = x != y;
+    if(compare == Compare::Greater ) bit = x > y;
+    if(compare == Compare::Less    ) bit = x < y;
+    if(compare == Compare::Delta   ) bit = uint8_t(x - y) == value;
+    if(compare == Compare::Value   ) bit = x == value;
+    result |= (uint64_t)bit << n;
+  }
+  #endif
+
+  return result;
+}
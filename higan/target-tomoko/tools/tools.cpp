@@ -7,6 +7,7 @@ unique_pointer<CheatDatabase> cheatDatabase;
 #include "state-manager.cpp"
 #include "manifest-viewer.cpp"
 #include "game-notes.cpp"
+#include "ram-search.cpp"
 unique_pointer<ToolsManager> toolsManager;
 
 ToolsManager::ToolsManager() {
@@ -22,6 +23,7 @@ ToolsManager::ToolsManager() {
   onSize([&] {
     cheatEditor.cheatList.resizeColumns();
     stateManager.stateList.resizeColumns();
+    ramSearch.resultList.resizeColumns();
   });
 }
 
@@ -50,6 +50,46 @@ struct CheatEditor : TabFrameItem {
       Button eraseButton{&controlLayout, Size{80, 0}};
 };
 
+struct RAMSearch : TabFrameItem {
+  enum class Compare : uint { Equal, NotEqual, Greater, Less, Delta, Value };
+  enum : uint { ListLimit = 256 };
+
+  RAMSearch(TabFrame*);
+  auto doReset() -> void;
+  auto doFilter() -> void;
+  auto doRefresh() -> void;
+  auto doAddCheat() -> void;
+
+  struct Region {
+    Emulator::Interface::MemoryRegion source;
+    vector<uint8_t> snapshot;      //values as of the previous filter
+    vector<uint64_t> candidates;  //one bit per byte of source
+    uint count = 0;
+  };
+  vector<Region> regions;
+
+  struct Result {
+    uint address;
+    uint8_t data;
+  };
+  vector<Result> results;
+
+  VerticalLayout layout{this};
+    TableView resultList{&layout, Size{~0, ~0}};
+    HorizontalLayout controlLayout{&layout, Size{~0, 0}};
+      ComboButton compareOption{&controlLayout, Size{0, 0}};
+      LineEdit compareValue{&controlLayout, Size{40, 0}};
+      Button filterButton{&controlLayout, Size{80, 0}};
+      Label countLabel{&controlLayout, Size{~0, 0}};
+      Button addCheatButton{&controlLayout, Size{80, 0}};
+      Button resetButton{&controlLayout, Size{80, 0}};
+
+private:
+  static auto digits(uint address) -> uint;
+  template<Compare> auto filter(Region& region, uint8_t value) -> void;
+  template<Compare> static auto match(const uint8_t* current, const uint8_t* previous, uint8_t value) -> uint64_t;
+};
+
 struct StateManager : TabFrameItem {
   enum : uint { Slots = 32 };
 
@@ -103,6 +143,7 @@ struct ToolsManager : Window {
       StateManager stateManager{&panel};
       ManifestViewer manifestViewer{&panel};
       GameNotes gameNotes{&panel};
+      RAMSearch ramSearch{&panel};
 };
 
 extern unique_pointer<CheatDatabase> cheatDatabase;
@@ -37,9 +37,9 @@ auto Video::setPalette() -> void {
   palette = new uint32[colors];
   for(auto index : range(colors)) {
     uint64 color = interface->videoColor(index);
-    uint16 b = color.bits( 0,15);
-    uint16 g = color.bits(16,31);
-    uint16 r = color.bits(32,47);
+    uint16 b = color.bits< 0,15>();
+    uint16 g = color.bits<16,31>();
+    uint16 r = color.bits<32,47>();
     uint16 a = 0xffff;
 
     if(saturation != 1.0) {
@@ -64,7 +64,7 @@ auto Video::setPalette() -> void {
     }
 
     //convert color from 16-bits/channel to 8-bits/channel; force alpha to 1.0
-    palette[index] = a.byte(1) << 24 | r.byte(1) << 16 | g.byte(1) << 8 | b.byte(1) << 0;
+    palette[index] = a.byte<1>() << 24 | r.byte<1>() << 16 | g.byte<1>() << 8 | b.byte<1>() << 0;
   }
 }
 
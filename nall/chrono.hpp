@@ -17,7 +17,7 @@ auto microsecond() -> uint64_t { return nanosecond() / 1'000; }
 auto millisecond() -> uint64_t { return nanosecond() / 1'000'000; }
 auto second() -> uint64_t { return nanosecond() / 1'000'000'000; }
 
-auto benchmark(const function<void ()>& f, uint64_t times = 1) -> void {
+auto benchmark(const function_ref<void ()>& f, uint64_t times = 1) -> void {
   auto start = nanosecond();
   while(times--) f();
   auto end = nanosecond();
@@ -1,10 +1,14 @@
 #pragma once
 
+#include <new>
+
+#include <nall/stdint.hpp>
 #include <nall/traits.hpp>
 
 namespace nall {
 
 template<typename T> struct function;
+template<typename T> struct function_ref;
 
 template<typename R, typename... P> struct function<auto (P...) -> R> {
   //value = true if auto L::operator()(P...) -> R exists
@@ -14,57 +18,127 @@ template<typename R, typename... P> struct function<auto (P...) -> R> {
     static constexpr bool value = decltype(exists<L>(0))::value;
   };
 
+  //targets up to this size are stored inline: this covers globals, members and lambdas capturing a few words
+  static constexpr uint Capacity = 4 * sizeof(void*);
+
   function() {}
   function(const function& source) { operator=(source); }
-  function(void* function) { if(function) callback = new global((auto (*)(P...) -> R)function); }
-  function(auto (*function)(P...) -> R) { callback = new global(function); }
-  template<typename C> function(auto (C::*function)(P...) -> R, C* object) { callback = new member<C>(function, object); }
-  template<typename C> function(auto (C::*function)(P...) const -> R, C* object) { callback = new member<C>((auto (C::*)(P...) -> R)function, object); }
-  template<typename L, typename = enable_if_t<is_compatible<L>::value>> function(const L& object) { callback = new lambda<L>(object); }
-  ~function() { if(callback) delete callback; }
+  function(function&& source) { operator=(move(source)); }
+  function(void* function) { if(function) assign((auto (*)(P...) -> R)function); }
+  function(auto (*function)(P...) -> R) { if(function) assign(function); }
+  template<typename C> function(auto (C::*function)(P...) -> R, C* object) { assign(member<C>{function, object}); }
+  template<typename C> function(auto (C::*function)(P...) const -> R, C* object) { assign(member<C>{(auto (C::*)(P...) -> R)function, object}); }
+  template<typename L, typename = enable_if_t<is_compatible<L>::value>> function(const L& object) { assign(object); }
+  ~function() { reset(); }
 
-  explicit operator bool() const { return callback; }
-  auto operator()(P... p) const -> R { return (*callback)(forward<P>(p)...); }
-  auto reset() -> void { if(callback) { delete callback; callback = nullptr; } }
+  explicit operator bool() const { return invoke; }
+  auto operator()(P... p) const -> R { return invoke(storage, forward<P>(p)...); }
+  auto reset() -> void { if(manage) manage(Destroy, storage, nullptr); invoke = nullptr; manage = nullptr; }
 
   auto operator=(const function& source) -> function& {
     if(this != &source) {
-      if(callback) { delete callback; callback = nullptr; }
-      if(source.callback) callback = source.callback->copy();
+      reset();
+      if(source.manage) source.manage(Copy, storage, source.storage);
+      invoke = source.invoke;
+      manage = source.manage;
     }
     return *this;
   }
 
-private:
-  struct container {
-    virtual auto operator()(P... p) const -> R = 0;
-    virtual auto copy() const -> container* = 0;
-    virtual ~container() = default;
-  };
+  auto operator=(function&& source) -> function& {
+    if(this != &source) {
+      reset();
+      if(source.manage) source.manage(Move, storage, source.storage);
+      invoke = source.invoke;
+      manage = source.manage;
+      source.invoke = nullptr;
+      source.manage = nullptr;
+    }
+    return *this;
+  }
 
-  container* callback = nullptr;
+private:
+  enum Operation : uint { Copy, Move, Destroy };
 
-  struct global : container {
-    auto (*function)(P...) -> R;
-    auto operator()(P... p) const -> R { return function(forward<P>(p)...); }
-    auto copy() const -> container* { return new global(function); }
-    global(auto (*function)(P...) -> R) : function(function) {}
-  };
+  alignas(void*) mutable char storage[Capacity];
+  auto (*invoke)(void* storage, P... p) -> R = nullptr;
+  auto (*manage)(Operation operation, void* target, void* source) -> void = nullptr;
 
-  template<typename C> struct member : container {
+  template<typename C> struct member {
     auto (C::*function)(P...) -> R;
     C* object;
     auto operator()(P... p) const -> R { return (object->*function)(forward<P>(p)...); }
-    auto copy() const -> container* { return new member(function, object); }
-    member(auto (C::*function)(P...) -> R, C* object) : function(function), object(object) {}
   };
 
-  template<typename L> struct lambda : container {
-    mutable L object;
-    auto operator()(P... p) const -> R { return object(forward<P>(p)...); }
-    auto copy() const -> container* { return new lambda(object); }
-    lambda(const L& object) : object(object) {}
+  //targets that are too large, over-aligned or may throw while moving are kept on the heap instead
+  template<typename T> struct is_inline {
+    static constexpr bool value = sizeof(T) <= Capacity && alignof(T) <= alignof(void*)
+      && std::is_nothrow_move_constructible<T>::value;
+  };
+
+  template<typename T, bool = is_inline<T>::value> struct target {
+    static auto get(void* storage) -> T& { return *(T*)storage; }
+    static auto create(void* storage, const T& object) -> void { new(storage) T(object); }
+
+    static auto call(void* storage, P... p) -> R { return get(storage)(forward<P>(p)...); }
+    static auto manage(Operation operation, void* target, void* source) -> void {
+      if(operation == Copy) new(target) T(get(source));
+      if(operation == Move) { new(target) T(move(get(source))); get(source).~T(); }
+      if(operation == Destroy) get(target).~T();
+    }
   };
+
+  template<typename T> struct target<T, false> {
+    static auto get(void* storage) -> T& { return **(T**)storage; }
+    static auto create(void* storage, const T& object) -> void { *(T**)storage = new T(object); }
+
+    static auto call(void* storage, P... p) -> R { return get(storage)(forward<P>(p)...); }
+    static auto manage(Operation operation, void* target, void* source) -> void {
+      if(operation == Copy) *(T**)target = new T(get(source));
+      if(operation == Move) *(T**)target = *(T**)source;
+      if(operation == Destroy) delete *(T**)target;
+    }
+  };
+
+  template<typename T> auto assign(const T& object) -> void {
+    target<T>::create(storage, object);
+    invoke = &target<T>::call;
+    manage = &target<T>::manage;
+  }
+};
+
+//non-owning reference to a callable: trivially copyable, never allocates, one indirect call per invocation
+//the referenced callable must outlive every function_ref bound to it
+template<typename R, typename... P> struct function_ref<auto (P...) -> R> {
+  template<typename L> using is_compatible = typename function<auto (P...) -> R>::template is_compatible<L>;
+
+  function_ref() = default;
+  function_ref(auto (*function)(P...) -> R) {
+    if(!function) return;
+    target.global = function;
+    invoke = [](Target target, P... p) -> R { return target.global(forward<P>(p)...); };
+  }
+  template<typename L, typename = enable_if_t<is_compatible<L>::value>> function_ref(const L& object) {
+    target.object = (const void*)&object;
+    invoke = [](Target target, P... p) -> R { return (*(L*)target.object)(forward<P>(p)...); };
+  }
+  template<typename L> function_ref(const function<L>& object) {
+    if(!object) return;
+    target.object = (const void*)&object;
+    invoke = [](Target target, P... p) -> R { return (*(const function<L>*)target.object)(forward<P>(p)...); };
+  }
+
+  explicit operator bool() const { return invoke; }
+  auto operator()(P... p) const -> R { return invoke(target, forward<P>(p)...); }
+
+private:
+  union Target {
+    const void* object;
+    auto (*global)(P...) -> R;
+  };
+
+  Target target{nullptr};
+  auto (*invoke)(Target target, P... p) -> R = nullptr;
 };
 
 }
@@ -22,6 +22,11 @@ struct shared_memory {
     return _size;
   }
 
+  //unsynchronized access, for callers that coordinate through the segment contents themselves
+  auto data() -> uint8_t* {
+    return _data;
+  }
+
   auto acquired() const -> bool {
     return _acquired;
   }
@@ -105,6 +105,46 @@ template<uint Bits> struct Natural {
   inline auto bit(uint index) const -> const Reference { return {(Natural&)*this, index, index}; }
   inline auto byte(uint index) const -> const Reference { return {(Natural&)*this, index * 8 + 0, index * 8 + 7}; }
 
+  //bit range fixed at compile time: masks and shifts fold to constants
+  template<uint Lo, uint Hi> struct Range {
+    static_assert(Lo <= Hi && Hi < Bits, "bit range out of bounds");
+    enum : type { RangeMask = (~0ull >> (63 - (Hi - Lo))) << Lo & Mask };
+
+    inline Range(Natural& source) : source(source) {}
+    inline auto& operator=(const Range& source) { return set(source.get()); }
+
+    inline auto get() const -> type { return (source.data & RangeMask) >> Lo; }
+    inline auto& set(const type value) { source.data = (source.data & ~RangeMask) | ((value << Lo) & RangeMask); return *this; }
+
+    inline operator type() const { return get(); }
+    inline auto& operator  =(const type value) { return set(         value); }
+    inline auto& operator &=(const type value) { return set(get()  & value); }
+    inline auto& operator |=(const type value) { return set(get()  | value); }
+    inline auto& operator ^=(const type value) { return set(get()  ^ value); }
+    inline auto& operator<<=(const type value) { return set(get() << value); }
+    inline auto& operator>>=(const type value) { return set(get() >> value); }
+    inline auto& operator +=(const type value) { return set(get()  + value); }
+    inline auto& operator -=(const type value) { return set(get()  - value); }
+    inline auto& operator *=(const type value) { return set(get()  * value); }
+    inline auto& operator /=(const type value) { return set(get()  / value); }
+    inline auto& operator %=(const type value) { return set(get()  % value); }
+    inline auto  operator++(int) { auto value = get(); set(value + 1); return value; }
+    inline auto  operator--(int) { auto value = get(); set(value - 1); return value; }
+    inline auto& operator++() { return set(get() + 1); }
+    inline auto& operator--() { return set(get() - 1); }
+
+  private:
+    Natural& source;
+  };
+
+  template<uint Lo, uint Hi> inline auto bits() -> Range<(Lo < Hi ? Lo : Hi), (Hi > Lo ? Hi : Lo)> { return {*this}; }
+  template<uint Index> inline auto bit() -> Range<Index, Index> { return {*this}; }
+  template<uint Index> inline auto byte() -> Range<Index * 8 + 0, Index * 8 + 7> { return {*this}; }
+
+  template<uint Lo, uint Hi> inline auto bits() const -> const Range<(Lo < Hi ? Lo : Hi), (Hi > Lo ? Hi : Lo)> { return {(Natural&)*this}; }
+  template<uint Index> inline auto bit() const -> const Range<Index, Index> { return {(Natural&)*this}; }
+  template<uint Index> inline auto byte() const -> const Range<Index * 8 + 0, Index * 8 + 7> { return {(Natural&)*this}; }
+
   inline auto clamp(uint bits) -> uintmax {
     const uintmax b = 1ull << (bits - 1);
     const uintmax m = b * 2 - 1;
@@ -209,6 +249,46 @@ template<uint Bits> struct Integer {
   inline auto bit(uint index) const -> const Reference { return {(Integer&)*this, index, index}; }
   inline auto byte(uint index) const -> const Reference { return {(Integer&)*this, index * 8 + 0, index * 8 + 7}; }
 
+  //bit range fixed at compile time: masks and shifts fold to constants
+  template<uint Lo, uint Hi> struct Range {
+    static_assert(Lo <= Hi && Hi < Bits, "bit range out of bounds");
+    enum : utype { RangeMask = (~0ull >> (63 - (Hi - Lo))) << Lo & Mask };
+
+    inline Range(Integer& source) : source(source) {}
+    inline auto& operator=(const Range& source) { return set(source.get()); }
+
+    inline auto get() const -> utype { return ((utype)source.data & RangeMask) >> Lo; }
+    inline auto& set(const utype value) { source.set(((utype)source.data & ~RangeMask) | ((value << Lo) & RangeMask)); return *this; }
+
+    inline operator utype() const { return get(); }
+    inline auto& operator  =(const utype value) { return set(         value); }
+    inline auto& operator &=(const utype value) { return set(get()  & value); }
+    inline auto& operator |=(const utype value) { return set(get()  | value); }
+    inline auto& operator ^=(const utype value) { return set(get()  ^ value); }
+    inline auto& operator<<=(const utype value) { return set(get() << value); }
+    inline auto& operator>>=(const utype value) { return set(get() >> value); }
+    inline auto& operator +=(const utype value) { return set(get()  + value); }
+    inline auto& operator -=(const utype value) { return set(get()  - value); }
+    inline auto& operator *=(const utype value) { return set(get()  * value); }
+    inline auto& operator /=(const utype value) { return set(get()  / value); }
+    inline auto& operator %=(const utype value) { return set(get()  % value); }
+    inline auto  operator++(int) { auto value = get(); set(value + 1); return value; }
+    inline auto  operator--(int) { auto value = get(); set(value - 1); return value; }
+    inline auto& operator++() { return set(get() + 1); }
+    inline auto& operator--() { return set(get() - 1); }
+
+  private:
+    Integer& source;
+  };
+
+  template<uint Lo, uint Hi> inline auto bits() -> Range<(Lo < Hi ? Lo : Hi), (Hi > Lo ? Hi : Lo)> { return {*this}; }
+  template<uint Index> inline auto bit() -> Range<Index, Index> { return {*this}; }
+  template<uint Index> inline auto byte() -> Range<Index * 8 + 0, Index * 8 + 7> { return {*this}; }
+
+  template<uint Lo, uint Hi> inline auto bits() const -> const Range<(Lo < Hi ? Lo : Hi), (Hi > Lo ? Hi : Lo)> { return {(Integer&)*this}; }
+  template<uint Index> inline auto bit() const -> const Range<Index, Index> { return {(Integer&)*this}; }
+  template<uint Index> inline auto byte() const -> const Range<Index * 8 + 0, Index * 8 + 7> { return {(Integer&)*this}; }
+
   inline auto clamp(uint bits) -> intmax {
     const intmax b = 1ull << (bits - 1);
     const intmax m = b - 1;
@@ -77,6 +77,15 @@ struct queue {
     return _read != _write;
   }
 
+  //number of values written but not yet read; at most size() - 1 when used as a FIFO
+  auto count() const -> uint {
+    return _write >= _read ? _write - _read : _size - _read + _write;
+  }
+
+  auto full() const -> bool {
+    return count() + 1 >= _size;
+  }
+
   auto read() -> T {
     T result = _data[_read];
     if(++_read >= _size) _read = 0;
@@ -11,6 +11,7 @@
 //- only plain-old-data can be stored. complex classes must provide serialize(serializer&);
 //- floating-point usage is not portable across different implementations
 
+#include <nall/algorithm.hpp>
 #include <nall/range.hpp>
 #include <nall/stdint.hpp>
 #include <nall/traits.hpp>
@@ -27,6 +28,57 @@ struct has_serialize {
   static const bool value = sizeof(test<T>(0)) == sizeof(char);
 };
 
+//page-granular write tracking for large memories:
+//every page is stamped with the snapshot generation in which it was last written,
+//so that each consumer of incremental states can keep its own base snapshot
+struct dirtypages {
+  enum : uint { PageBits = 8, PageSize = 1 << PageBits };  //in elements
+
+  //generation 0 is never current: an incremental state against base 0 includes every page
+  static auto generation() -> uint& {
+    static uint value = 1;
+    return value;
+  }
+
+  //ends the current generation: returns its id, and stamps later writes with the next one
+  static auto snapshot() -> uint {
+    return generation()++;
+  }
+
+  dirtypages() = default;
+  dirtypages(uint size) { resize(size); }
+  dirtypages(const dirtypages&) = delete;
+  auto operator=(const dirtypages&) -> dirtypages& = delete;
+  ~dirtypages() { delete[] _stamps; }
+
+  auto pages() const -> uint {
+    return _pages;
+  }
+
+  auto resize(uint size) -> void {
+    delete[] _stamps;
+    _pages = (size + PageSize - 1) >> PageBits;
+    _stamps = _pages ? new uint[_pages] : nullptr;
+    markAll();
+  }
+
+  auto mark(uint address) -> void {
+    _stamps[address >> PageBits] = generation();
+  }
+
+  auto markAll() -> void {
+    for(uint page : range(_pages)) _stamps[page] = generation();
+  }
+
+  auto changed(uint page, uint base) const -> bool {
+    return _stamps[page] > base;
+  }
+
+private:
+  uint* _stamps = nullptr;
+  uint _pages = 0;
+};
+
 struct serializer {
   enum Mode : uint { Load, Save, Size };
 
@@ -46,6 +98,26 @@ struct serializer {
     return _capacity;
   }
 
+  //incremental states only store the pages of tracked memories written since snapshot generation base,
+  //and can only be loaded on top of the state they were taken against
+  auto incremental() const -> bool {
+    return _incremental;
+  }
+
+  auto setIncremental(uint base = 0) -> void {
+    _incremental = true;
+    _base = base;
+  }
+
+  //the snapshot generation this state was taken as: the base for later incremental states
+  auto generation() const -> uint {
+    return _generation;
+  }
+
+  auto setGeneration(uint generation) -> void {
+    _generation = generation;
+  }
+
   template<typename T> auto floatingpoint(T& value) -> serializer& {
     enum : uint { size = sizeof(T) };
     //this is rather dangerous, and not cross-platform safe;
@@ -96,6 +168,38 @@ struct serializer {
     return *this;
   }
 
+  //size must not exceed the memory tracked by dirty; the page bitmap is only stored in incremental states,
+  //but is always counted by Size so that serializeInit() capacities hold either kind
+  template<typename T> auto pages(T* array, uint size, dirtypages& dirty) -> serializer& {
+    uint pages = (size + dirtypages::PageSize - 1) >> dirtypages::PageBits;
+    if(_mode == Size) {
+      _size += (pages + 7) >> 3;
+      return this->array(array, size);
+    }
+    if(!_incremental) {
+      this->array(array, size);
+      if(_mode == Load) dirty.markAll();
+      return *this;
+    }
+
+    uint bitmap = _size;
+    if(_mode == Save) {
+      for(uint page : range(pages)) {
+        if(!(page & 7)) _data[_size++] = 0;
+        if(dirty.changed(page, _base)) _data[bitmap + (page >> 3)] |= 1 << (page & 7);
+      }
+    } else {
+      _size += (pages + 7) >> 3;
+    }
+    for(uint page : range(pages)) {
+      if(!(_data[bitmap + (page >> 3)] >> (page & 7) & 1)) continue;
+      uint offset = page << dirtypages::PageBits;
+      this->array(array + offset, min(size - offset, (uint)dirtypages::PageSize));
+    }
+    if(_mode == Load) dirty.markAll();
+    return *this;
+  }
+
   template<typename T> auto operator()(T& value, typename std::enable_if<has_serialize<T>::value>::type* = 0) -> serializer& { value.serialize(*this); return *this; }
   template<typename T> auto operator()(T& value, typename std::enable_if<std::is_integral<T>::value>::type* = 0) -> serializer& { return integer(value); }
   template<typename T> auto operator()(T& value, typename std::enable_if<std::is_floating_point<T>::value>::type* = 0) -> serializer& { return floatingpoint(value); }
@@ -109,6 +213,9 @@ struct serializer {
     _data = new uint8_t[s._capacity];
     _size = s._size;
     _capacity = s._capacity;
+    _incremental = s._incremental;
+    _base = s._base;
+    _generation = s._generation;
 
     memcpy(_data, s._data, s._capacity);
     return *this;
@@ -121,6 +228,9 @@ struct serializer {
     _data = s._data;
     _size = s._size;
     _capacity = s._capacity;
+    _incremental = s._incremental;
+    _base = s._base;
+    _generation = s._generation;
 
     s._data = nullptr;
     return *this;
@@ -154,6 +264,9 @@ private:
   uint8_t* _data = nullptr;
   uint _size = 0;
   uint _capacity = 0;
+  bool _incremental = false;
+  uint _base = 0;
+  uint _generation = 0;
 };
 
 };
@@ -2,7 +2,7 @@
 
 namespace nall {
 
-template<typename T> auto vector<T>::sort(const function<bool (const T& lhs, const T& rhs)>& comparator) -> void {
+template<typename T> auto vector<T>::sort(const function_ref<bool (const T& lhs, const T& rhs)>& comparator) -> void {
   nall::sort(_pool, _size, comparator);
 }
 
@@ -14,6 +14,7 @@ struct shared_memory {
   explicit operator bool() const { return false; }
   auto empty() const -> bool { return true; }
   auto size() const -> uint { return 0; }
+  auto data() -> uint8_t* { return nullptr; }
   auto acquired() const -> bool { return false; }
   auto acquire() -> uint8_t* { return nullptr; }
   auto release() -> void {}